@@ -0,0 +1,194 @@
+// Created by Ian Copland on 2026-10-18
+//
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../ICMemory/ICMemory.h"
+
+#include <catch.hpp>
+#include <vector>
+
+namespace ICMemoryTest
+{
+    namespace
+    {
+        constexpr std::size_t k_linearAllocatorBufferSize = 16 * 1024;
+        constexpr std::size_t k_buddyAllocatorBufferSize = 16 * 1024;
+        constexpr std::size_t k_buddyAllocatorMinBlockSize = 16;
+        constexpr std::size_t k_pageSize = 4096;
+        constexpr std::size_t k_cacheLineSize = 64;
+
+        /// Allocates a single byte, followed by a block at every power of two alignment up to page size, from the given allocator and confirms that each block is correctly aligned.
+        ///
+        /// @param allocator
+        ///     The allocator to test.
+        ///
+        void TestAlignedAllocations(IC::IAllocator& allocator)
+        {
+            auto unaligned = allocator.Allocate(1);
+
+            for (std::size_t alignment = 1; alignment <= k_pageSize; alignment *= 2)
+            {
+                auto memory = allocator.Allocate(alignment, alignment);
+
+                REQUIRE(memory != nullptr);
+                REQUIRE(IC::MemoryUtils::IsAligned(memory, alignment));
+
+                allocator.Deallocate(memory);
+            }
+
+            allocator.Deallocate(unaligned);
+        }
+    }
+
+    /// A series of unit tests for aligned allocation.
+    ///
+    TEST_CASE("Alignment", "[Allocator]")
+    {
+        /// Confirms that aligned allocations can be made from a Buddy Allocator.
+        ///
+        SECTION("BuddyAllocator")
+        {
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            TestAlignedAllocations(allocator);
+        }
+
+        /// Confirms that aligned allocations can be made from a Linear Allocator.
+        ///
+        SECTION("LinearAllocator")
+        {
+            IC::LinearAllocator linearAllocator(k_linearAllocatorBufferSize);
+
+            TestAlignedAllocations(linearAllocator);
+        }
+
+        /// Confirms that aligned allocations can be made from a Paged Linear Allocator.
+        ///
+        SECTION("PagedLinearAllocator")
+        {
+            IC::PagedLinearAllocator pagedLinearAllocator(k_linearAllocatorBufferSize);
+
+            TestAlignedAllocations(pagedLinearAllocator);
+        }
+
+        /// Confirms that cache line aligned allocations can be made from a Paged Block Allocator whose block size is a multiple of the cache line size.
+        ///
+        SECTION("PagedBlockAllocator")
+        {
+            constexpr std::size_t k_numBlocksPerPage = 4;
+            constexpr std::size_t k_numAllocations = k_numBlocksPerPage * 2;
+
+            IC::PagedBlockAllocator pagedBlockAllocator(k_cacheLineSize, k_numBlocksPerPage);
+
+            std::vector<void*> allocations;
+            for (std::size_t i = 0; i < k_numAllocations; ++i)
+            {
+                auto memory = pagedBlockAllocator.Allocate(k_cacheLineSize, k_cacheLineSize);
+
+                REQUIRE(memory != nullptr);
+                REQUIRE(IC::MemoryUtils::IsAligned(memory, k_cacheLineSize));
+
+                allocations.push_back(memory);
+            }
+
+            for (auto memory : allocations)
+            {
+                pagedBlockAllocator.Deallocate(memory);
+            }
+        }
+
+        /// Confirms that the buffer of a Linear Allocator is cache line aligned, by checking that the first allocation,
+        /// which is placed at the start of the buffer, is cache line aligned even though no alignment was requested.
+        ///
+        SECTION("LinearAllocatorBufferAlignment")
+        {
+            IC::LinearAllocator linearAllocator(k_cacheLineSize * 2);
+
+            auto memory = linearAllocator.Allocate(1);
+
+            REQUIRE(memory != nullptr);
+            REQUIRE(IC::MemoryUtils::IsAligned(memory, k_cacheLineSize));
+        }
+
+        /// Confirms that a Linear Allocator does not reserve a full extra alignment worth of space for aligned allocations. Two cache line aligned, cache line sized allocations exactly fill the buffer, so this would fail if each allocation required size + alignment - 1 bytes.
+        /// This relies on the buffer itself being cache line aligned, which LinearAllocatorBufferAlignment confirms.
+        ///
+        SECTION("NoExcessSlack")
+        {
+            IC::LinearAllocator linearAllocator(k_cacheLineSize * 2);
+
+            auto memoryA = linearAllocator.Allocate(k_cacheLineSize, k_cacheLineSize);
+            auto memoryB = linearAllocator.Allocate(k_cacheLineSize, k_cacheLineSize);
+
+            REQUIRE(memoryA != nullptr);
+            REQUIRE(memoryB != nullptr);
+            REQUIRE(IC::MemoryUtils::IsAligned(memoryA, k_cacheLineSize));
+            REQUIRE(IC::MemoryUtils::IsAligned(memoryB, k_cacheLineSize));
+            REQUIRE(memoryA != memoryB);
+        }
+
+        /// Confirms that an over-aligned unique pointer can be allocated.
+        ///
+        SECTION("MakeUniqueAligned")
+        {
+            struct ExampleCounter
+            {
+                std::int64_t m_count;
+            };
+
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            auto counterA = IC::MakeUniqueAligned<ExampleCounter>(allocator, k_cacheLineSize);
+            auto counterB = IC::MakeUniqueAligned<ExampleCounter>(allocator, k_cacheLineSize);
+
+            REQUIRE(counterA != nullptr);
+            REQUIRE(counterB != nullptr);
+
+            counterA->m_count = 1;
+            counterB->m_count = 2;
+
+            REQUIRE(IC::MemoryUtils::IsAligned(counterA.get(), k_cacheLineSize));
+            REQUIRE(IC::MemoryUtils::IsAligned(counterB.get(), k_cacheLineSize));
+            REQUIRE(counterA->m_count == 1);
+            REQUIRE(counterB->m_count == 2);
+        }
+
+        /// Confirms that the storage of a vector can be allocated with a given alignment.
+        ///
+        SECTION("MakeVectorAligned")
+        {
+            constexpr std::size_t k_avxAlignment = 32;
+            constexpr int k_numValues = 100;
+
+            IC::LinearAllocator linearAllocator(k_linearAllocatorBufferSize);
+
+            auto vec = IC::MakeVectorAligned<float>(linearAllocator, k_avxAlignment);
+            for (auto i = 0; i < k_numValues; ++i)
+            {
+                vec.push_back(static_cast<float>(i));
+
+                REQUIRE(IC::MemoryUtils::IsAligned(vec.data(), k_avxAlignment));
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,195 @@
+// Created by Ian Copland on 2026-10-18
+//
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../ICMemory/ICMemory.h"
+
+#include <catch.hpp>
+#include <type_traits>
+
+namespace ICMemoryTest
+{
+    namespace
+    {
+        constexpr std::size_t k_linearAllocatorBufferSize = 32;
+        constexpr std::size_t k_buddyAllocatorBufferSize = 8 * 1024;
+        constexpr std::size_t k_buddyAllocatorMinBlockSize = 16;
+        constexpr std::size_t k_smallObjectAllocatorSize = 1024;
+        constexpr std::size_t k_smallThreshold = 64;
+        constexpr std::size_t k_mediumThreshold = 512;
+        constexpr std::size_t k_blockSize = 512;
+        constexpr std::size_t k_pageSize = 4;
+
+        /// A prefix placed in front of every allocation made by an AffixAllocator.
+        ///
+        struct ExamplePrefix
+        {
+            std::uint32_t m_guard = 0xABCDABCD;
+        };
+
+        /// A suffix placed after every allocation made by an AffixAllocator.
+        ///
+        struct ExampleSuffix
+        {
+            std::uint32_t m_guard = 0xDCBADCBA;
+        };
+    }
+
+    /// A series of unit tests for the allocator composition templates.
+    ///
+    TEST_CASE("AllocatorComposition", "[Allocator]")
+    {
+        /// Confirms that every composed allocator can be used through the IAllocator interface.
+        ///
+        SECTION("IAllocator")
+        {
+            using Fallback = IC::FallbackAllocator<IC::LinearAllocator, IC::BuddyAllocator>;
+            using Segregator = IC::Segregator<k_smallThreshold, IC::SmallObjectAllocator, IC::BuddyAllocator>;
+            using Affix = IC::AffixAllocator<IC::BuddyAllocator, ExamplePrefix, ExampleSuffix>;
+
+            REQUIRE((std::is_base_of<IC::IAllocator, Fallback>::value));
+            REQUIRE((std::is_base_of<IC::IAllocator, Segregator>::value));
+            REQUIRE((std::is_base_of<IC::IAllocator, Affix>::value));
+        }
+
+        /// Confirms that a FallbackAllocator uses its primary allocator until it is exhausted, then falls back to the secondary allocator.
+        ///
+        SECTION("Fallback")
+        {
+            constexpr int k_numValues = 8;
+
+            IC::LinearAllocator linearAllocator(k_linearAllocatorBufferSize);
+            IC::BuddyAllocator buddyAllocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+            IC::FallbackAllocator<IC::LinearAllocator, IC::BuddyAllocator> allocator(linearAllocator, buddyAllocator);
+
+            auto first = IC::MakeUnique<std::int64_t>(allocator, 0);
+            REQUIRE(linearAllocator.Owns(first.get()));
+
+            IC::UniquePtr<std::int64_t> values[k_numValues];
+            for (auto i = 0; i < k_numValues; ++i)
+            {
+                values[i] = IC::MakeUnique<std::int64_t>(allocator, i);
+            }
+
+            REQUIRE(buddyAllocator.Owns(values[k_numValues - 1].get()));
+            for (auto i = 0; i < k_numValues; ++i)
+            {
+                REQUIRE(*values[i] == i);
+            }
+        }
+
+        /// Confirms that a Segregator sends allocations at or below the threshold to the small allocator, and larger allocations to the large allocator.
+        ///
+        SECTION("Segregator")
+        {
+            struct LargeExampleClass
+            {
+                char buffer[128];
+            };
+
+            IC::SmallObjectAllocator smallObjectAllocator(k_smallObjectAllocatorSize);
+            IC::BuddyAllocator buddyAllocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+            IC::Segregator<k_smallThreshold, IC::SmallObjectAllocator, IC::BuddyAllocator> allocator(smallObjectAllocator, buddyAllocator);
+
+            auto small = IC::MakeUnique<int>(allocator, 1);
+            auto large = IC::MakeUnique<LargeExampleClass>(allocator);
+
+            REQUIRE(*small == 1);
+            REQUIRE(smallObjectAllocator.Owns(small.get()));
+            REQUIRE(buddyAllocator.Owns(large.get()));
+        }
+
+        /// Confirms that Segregators can be nested to build a three tier allocator.
+        ///
+        SECTION("NestedSegregator")
+        {
+            struct MediumExampleClass
+            {
+                char buffer[256];
+            };
+
+            struct LargeExampleClass
+            {
+                char buffer[1024];
+            };
+
+            using LargeSegregator = IC::Segregator<k_mediumThreshold, IC::PagedBlockAllocator, IC::BuddyAllocator>;
+
+            IC::SmallObjectAllocator smallObjectAllocator(k_smallObjectAllocatorSize);
+            IC::PagedBlockAllocator pagedBlockAllocator(k_blockSize, k_pageSize);
+            IC::BuddyAllocator buddyAllocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+            LargeSegregator largeSegregator(pagedBlockAllocator, buddyAllocator);
+            IC::Segregator<k_smallThreshold, IC::SmallObjectAllocator, LargeSegregator> allocator(smallObjectAllocator, largeSegregator);
+
+            auto small = IC::MakeUnique<int>(allocator, 1);
+            auto medium = IC::MakeUnique<MediumExampleClass>(allocator);
+            auto large = IC::MakeUnique<LargeExampleClass>(allocator);
+
+            REQUIRE(smallObjectAllocator.Owns(small.get()));
+            REQUIRE(pagedBlockAllocator.Owns(medium.get()));
+            REQUIRE(buddyAllocator.Owns(large.get()));
+        }
+
+        /// Confirms that an AffixAllocator constructs a prefix and suffix around each allocation without affecting the allocated object.
+        ///
+        SECTION("Affix")
+        {
+            struct ExampleClass
+            {
+                int m_x, m_y;
+            };
+
+            using Affix = IC::AffixAllocator<IC::BuddyAllocator, ExamplePrefix, ExampleSuffix>;
+
+            IC::BuddyAllocator buddyAllocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+            Affix allocator(buddyAllocator);
+
+            auto allocated = IC::MakeUnique<ExampleClass>(allocator);
+            allocated->m_x = 1;
+            allocated->m_y = 2;
+
+            REQUIRE(allocated->m_x == 1);
+            REQUIRE(allocated->m_y == 2);
+            REQUIRE(Affix::GetPrefix(allocated.get()).m_guard == 0xABCDABCD);
+            REQUIRE(Affix::GetSuffix(allocated.get(), sizeof(ExampleClass)).m_guard == 0xDCBADCBA);
+        }
+
+        /// Confirms that containers can be allocated from a composed allocator.
+        ///
+        SECTION("Container")
+        {
+            IC::SmallObjectAllocator smallObjectAllocator(k_smallObjectAllocatorSize);
+            IC::BuddyAllocator buddyAllocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+            IC::Segregator<k_smallThreshold, IC::SmallObjectAllocator, IC::BuddyAllocator> allocator(smallObjectAllocator, buddyAllocator);
+
+            auto vec = IC::MakeVector<int>(allocator);
+            for (auto i = 0; i < 100; ++i)
+            {
+                vec.push_back(i);
+            }
+
+            REQUIRE(vec.size() == 100);
+            REQUIRE(vec[99] == 99);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,228 @@
+// Created by Ian Copland on 2026-10-18
+//
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../ICMemory/ICMemory.h"
+
+#include <catch.hpp>
+
+// Coroutines require C++20, which the v140 toolset does not provide, so these tests are only built against a newer
+// language standard.
+#if __cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
+
+#include <coroutine>
+#include <exception>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ICMemoryTest
+{
+    namespace
+    {
+        constexpr std::size_t k_linearAllocatorBufferSize = 4 * 1024;
+        constexpr int k_largeBufferSize = static_cast<int>(IC::CoroutineFrameAllocation::k_smallFrameThreshold / sizeof(int)) + 1;
+
+        /// A minimal coroutine task whose frame allocation is provided by the given promise mixin.
+        ///
+        template <typename TFrameAllocation> struct ExampleTask final
+        {
+            struct promise_type : TFrameAllocation
+            {
+                ExampleTask get_return_object() { return ExampleTask(std::coroutine_handle<promise_type>::from_promise(*this)); }
+                std::suspend_always initial_suspend() noexcept { return {}; }
+                std::suspend_always final_suspend() noexcept { return {}; }
+                void return_value(int value) { m_value = value; }
+                void unhandled_exception() { std::terminate(); }
+
+                int m_value = 0;
+            };
+
+            explicit ExampleTask(std::coroutine_handle<promise_type> handle) : m_handle(handle) {}
+            ExampleTask(ExampleTask&& other) noexcept : m_handle(std::exchange(other.m_handle, nullptr)) {}
+            ExampleTask(const ExampleTask&) = delete;
+            ExampleTask& operator=(const ExampleTask&) = delete;
+            ~ExampleTask() { if (m_handle) { m_handle.destroy(); } }
+
+            /// Resumes the coroutine until it completes.
+            ///
+            /// @return The value returned by the coroutine.
+            ///
+            int Run()
+            {
+                while (!m_handle.done())
+                {
+                    m_handle.resume();
+                }
+
+                return m_handle.promise().m_value;
+            }
+
+            std::coroutine_handle<promise_type> m_handle;
+        };
+
+        using PooledTask = ExampleTask<IC::CoroutineFrameAllocation>;
+        using LinearTask = ExampleTask<IC::LinearCoroutineFrameAllocation>;
+
+        /// A coroutine with a small frame. The exact frame size is chosen by the compiler, so it is not guaranteed to fall
+        /// below the small frame threshold.
+        ///
+        PooledTask SmallCoroutine(int value)
+        {
+            co_return value * 2;
+        }
+
+        /// A coroutine which keeps a buffer alive across a suspension point, giving it a frame larger than the small frame threshold.
+        ///
+        PooledTask LargeCoroutine(int value)
+        {
+            int buffer[k_largeBufferSize];
+            for (auto i = 0; i < k_largeBufferSize; ++i)
+            {
+                buffer[i] = value;
+            }
+
+            co_await std::suspend_always();
+
+            auto sum = 0;
+            for (auto i = 0; i < k_largeBufferSize; ++i)
+            {
+                sum += buffer[i];
+            }
+
+            co_return sum;
+        }
+
+        /// A coroutine whose frame is allocated from the given Linear Allocator.
+        ///
+        LinearTask LinearCoroutine(IC::LinearAllocator&, int value)
+        {
+            co_await std::suspend_always();
+            co_return value * 2;
+        }
+    }
+
+    /// A series of unit tests for coroutine frame allocation.
+    ///
+    TEST_CASE("CoroutineFrameAllocation", "[Allocator]")
+    {
+        /// Confirms that a coroutine with a small frame is allocated from the calling thread's Small Object Allocator if
+        /// the frame size requested by the compiler is within the small frame threshold, otherwise from the calling
+        /// thread's Paged Block Allocator, and can be run.
+        ///
+        SECTION("SmallFrame")
+        {
+            auto task = SmallCoroutine(1);
+            const auto frameSize = IC::CoroutineFrameAllocation::GetLastFrameSize();
+            const auto isSmallFrame = frameSize <= IC::CoroutineFrameAllocation::k_smallFrameThreshold;
+
+            REQUIRE(frameSize > 0);
+            REQUIRE(IC::CoroutineFrameAllocation::GetSmallFrameAllocator().Owns(task.m_handle.address()) == isSmallFrame);
+            REQUIRE(IC::CoroutineFrameAllocation::GetLargeFrameAllocator().Owns(task.m_handle.address()) == !isSmallFrame);
+            REQUIRE(task.Run() == 2);
+        }
+
+        /// Confirms that a coroutine with a frame larger than the small frame threshold is allocated from the calling
+        /// thread's Paged Block Allocator and can be run.
+        ///
+        SECTION("LargeFrame")
+        {
+            auto task = LargeCoroutine(1);
+
+            REQUIRE(IC::CoroutineFrameAllocation::GetLastFrameSize() > IC::CoroutineFrameAllocation::k_smallFrameThreshold);
+            REQUIRE(IC::CoroutineFrameAllocation::GetLargeFrameAllocator().Owns(task.m_handle.address()));
+            REQUIRE(!IC::CoroutineFrameAllocation::GetSmallFrameAllocator().Owns(task.m_handle.address()));
+            REQUIRE(task.Run() == k_largeBufferSize);
+        }
+
+        /// Confirms that many coroutines can be alive at once.
+        ///
+        SECTION("ManyFrames")
+        {
+            constexpr int k_numTasks = 1000;
+
+            std::vector<PooledTask> tasks;
+            for (auto i = 0; i < k_numTasks; ++i)
+            {
+                tasks.push_back(i % 2 == 0 ? SmallCoroutine(i) : LargeCoroutine(i));
+            }
+
+            for (auto i = 0; i < k_numTasks; ++i)
+            {
+                REQUIRE(tasks[i].Run() == (i % 2 == 0 ? i * 2 : i * k_largeBufferSize));
+            }
+        }
+
+        /// Confirms that a coroutine frame allocated on one thread can be destroyed on another.
+        ///
+        SECTION("CrossThread")
+        {
+            auto smallTask = SmallCoroutine(1);
+            auto largeTask = LargeCoroutine(1);
+
+            std::thread thread([&smallTask, &largeTask]()
+            {
+                smallTask.Run();
+                largeTask.Run();
+
+                auto movedSmallTask = std::move(smallTask);
+                auto movedLargeTask = std::move(largeTask);
+            });
+            thread.join();
+
+            auto task = SmallCoroutine(2);
+            REQUIRE(task.Run() == 4);
+        }
+
+        /// Confirms that coroutine frames can be allocated from a Linear Allocator which is reset between batches.
+        ///
+        SECTION("LinearAllocator")
+        {
+            constexpr int k_numBatches = 100;
+            constexpr int k_numTasksPerBatch = 8;
+
+            IC::LinearAllocator linearAllocator(k_linearAllocatorBufferSize);
+
+            for (auto i = 0; i < k_numBatches; ++i)
+            {
+                {
+                    std::vector<LinearTask> tasks;
+                    for (auto j = 0; j < k_numTasksPerBatch; ++j)
+                    {
+                        tasks.push_back(LinearCoroutine(linearAllocator, j));
+                    }
+
+                    for (auto j = 0; j < k_numTasksPerBatch; ++j)
+                    {
+                        REQUIRE(linearAllocator.Owns(tasks[j].m_handle.address()));
+                        REQUIRE(tasks[j].Run() == j * 2);
+                    }
+                }
+
+                linearAllocator.Reset();
+            }
+        }
+    }
+}
+
+#endif
\ No newline at end of file
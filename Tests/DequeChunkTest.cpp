@@ -0,0 +1,110 @@
+// Created by Ian Copland on 2026-10-18
+//
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../ICMemory/ICMemory.h"
+
+#include <catch.hpp>
+
+namespace ICMemoryTest
+{
+    namespace
+    {
+        constexpr std::size_t k_linearAllocatorBufferSize = 4 * 1024;
+        constexpr std::size_t k_buddyAllocatorBufferSize = 2048;
+        constexpr std::size_t k_buddyAllocatorMinBlockSize = 16;
+    }
+
+    /// A series of unit tests for the chunk geometry and chunk recycling of deques allocated from the memory pools.
+    ///
+    TEST_CASE("DequeChunk", "[Container]")
+    {
+        /// Confirms that a deque allocated from a Block Allocator uses chunks which fill an entire block.
+        ///
+        SECTION("ChunkSizeBlockAllocator")
+        {
+            constexpr std::size_t k_blockSize = 64;
+            constexpr std::size_t k_numBlocks = 8;
+
+            IC::BlockAllocator blockAllocator(k_blockSize, k_numBlocks);
+
+            auto deque = IC::MakeDeque<int>(blockAllocator);
+            deque.push_back(5);
+
+            REQUIRE(deque.GetChunkSize() == k_blockSize);
+        }
+
+        /// Confirms that a deque allocated from a Paged Block Allocator uses chunks which fill an entire block.
+        ///
+        SECTION("ChunkSizePagedBlockAllocator")
+        {
+            constexpr std::size_t k_blockSize = 64;
+            constexpr std::size_t k_pageSize = 4;
+
+            IC::PagedBlockAllocator pagedBlockAllocator(k_blockSize, k_pageSize);
+
+            auto deque = IC::MakeDeque<int>(pagedBlockAllocator);
+            deque.push_back(5);
+
+            REQUIRE(deque.GetChunkSize() == k_blockSize);
+        }
+
+        /// Confirms that a deque allocated from a Buddy Allocator uses chunks which fill an entire buddy block.
+        ///
+        SECTION("ChunkSizeBuddyAllocator")
+        {
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            auto deque = IC::MakeDeque<int>(allocator);
+            deque.push_back(5);
+
+            auto chunkSize = deque.GetChunkSize();
+
+            REQUIRE(chunkSize >= k_buddyAllocatorMinBlockSize);
+            REQUIRE((chunkSize & (chunkSize - 1)) == 0);
+        }
+
+        /// Confirms that chunks released by pop_front() are recycled by push_back(). The Linear Allocator never
+        /// reclaims memory, so the buffer would be exhausted long before the loop ends if a new chunk was allocated
+        /// every time one was needed.
+        ///
+        SECTION("ChunkRecycling")
+        {
+            constexpr int k_numCycles = 10000;
+
+            IC::LinearAllocator linearAllocator(k_linearAllocatorBufferSize);
+
+            auto deque = IC::MakeDeque<int>(linearAllocator);
+            deque.push_back(0);
+
+            for (auto i = 1; i < k_numCycles; ++i)
+            {
+                deque.push_back(i);
+                deque.pop_front();
+            }
+
+            REQUIRE(deque.size() == 1);
+            REQUIRE(deque.front() == k_numCycles - 1);
+        }
+    }
+}
\ No newline at end of file
@@ -141,5 +141,34 @@ namespace ICMemoryTest
             deque.pop_front();
             REQUIRE(deque.front() == 6);
         }
+
+        /// Confirms that elements remain in order when a deque spans multiple chunks.
+        ///
+        SECTION("MultipleChunks")
+        {
+            constexpr int k_numValues = 100;
+
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            auto deque = IC::MakeDeque<int>(allocator);
+            for (auto i = 0; i < k_numValues; ++i)
+            {
+                deque.push_back(i);
+                deque.push_front(-i);
+            }
+
+            REQUIRE(deque.size() == k_numValues * 2);
+            for (auto i = k_numValues - 1; i >= 0; --i)
+            {
+                REQUIRE(deque.front() == -i);
+                deque.pop_front();
+            }
+
+            for (auto i = 0; i < k_numValues; ++i)
+            {
+                REQUIRE(deque.front() == i);
+                deque.pop_front();
+            }
+        }
     }
 }
\ No newline at end of file
@@ -0,0 +1,186 @@
+// Created by Ian Copland on 2026-10-18
+//
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../ICMemory/ICMemory.h"
+
+#include <catch.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace ICMemoryTest
+{
+    namespace
+    {
+        constexpr std::size_t k_blockSize = 32;
+        constexpr std::size_t k_pageSize = 64;
+    }
+
+    /// A series of unit tests for the EpochAllocator.
+    ///
+    TEST_CASE("EpochAllocator", "[Allocator]")
+    {
+        /// Confirms that objects can be allocated from an EpochAllocator.
+        ///
+        SECTION("Allocate")
+        {
+            IC::PagedBlockAllocator pagedBlockAllocator(k_blockSize, k_pageSize);
+            IC::EpochAllocator epochAllocator(pagedBlockAllocator);
+
+            auto valueA = IC::MakeUnique<int>(epochAllocator, 1);
+            auto valueB = IC::MakeUnique<int>(epochAllocator, 2);
+
+            REQUIRE(*valueA == 1);
+            REQUIRE(*valueB == 2);
+        }
+
+        /// Confirms that deallocations are deferred while another thread is inside a critical section.
+        ///
+        SECTION("Deferral")
+        {
+            IC::PagedBlockAllocator pagedBlockAllocator(k_blockSize, k_pageSize);
+            IC::EpochAllocator epochAllocator(pagedBlockAllocator);
+
+            std::atomic<bool> entered(false);
+            std::atomic<bool> release(false);
+            std::thread reader([&epochAllocator, &entered, &release]()
+            {
+                IC::EpochGuard guard(epochAllocator);
+                entered = true;
+
+                while (!release)
+                {
+                    std::this_thread::yield();
+                }
+            });
+
+            while (!entered)
+            {
+                std::this_thread::yield();
+            }
+
+            auto memory = epochAllocator.Allocate(sizeof(int));
+            epochAllocator.Deallocate(memory);
+            epochAllocator.Reclaim();
+
+            REQUIRE(epochAllocator.GetNumDeferred() == 1);
+
+            release = true;
+            reader.join();
+
+            epochAllocator.Reclaim();
+
+            REQUIRE(epochAllocator.GetNumDeferred() == 0);
+        }
+
+        /// Confirms that deferred deallocations are returned to the underlying allocator once no thread is inside a critical section.
+        ///
+        SECTION("Reclaim")
+        {
+            constexpr int k_numAllocations = 100;
+
+            IC::PagedBlockAllocator pagedBlockAllocator(k_blockSize, k_pageSize);
+            IC::EpochAllocator epochAllocator(pagedBlockAllocator);
+
+            for (auto i = 0; i < k_numAllocations; ++i)
+            {
+                epochAllocator.Deallocate(epochAllocator.Allocate(sizeof(int)));
+                epochAllocator.Reclaim();
+            }
+
+            REQUIRE(epochAllocator.GetNumDeferred() == 0);
+            REQUIRE(pagedBlockAllocator.GetNumPages() == 1);
+        }
+
+        /// Confirms that readers never observe a node which has been reused while they are reading it, when a writer repeatedly replaces and retires the shared node
+        /// and reclaims whatever retired nodes are no longer visible to any reader.
+        ///
+        SECTION("Threaded")
+        {
+            struct ExampleNode
+            {
+                std::int64_t m_a;
+                std::int64_t m_b;
+            };
+
+            constexpr int k_numReaders = 3;
+            constexpr int k_numUpdates = 10000;
+
+            IC::PagedBlockAllocator pagedBlockAllocator(k_blockSize, k_pageSize);
+            IC::EpochAllocator epochAllocator(pagedBlockAllocator);
+
+            auto initial = static_cast<ExampleNode*>(epochAllocator.Allocate(sizeof(ExampleNode)));
+            initial->m_a = 0;
+            initial->m_b = 0;
+
+            std::atomic<ExampleNode*> shared(initial);
+            std::atomic<bool> finished(false);
+            std::atomic<int> numTorn(0);
+
+            std::vector<std::thread> readers;
+            for (auto i = 0; i < k_numReaders; ++i)
+            {
+                readers.emplace_back([&epochAllocator, &shared, &finished, &numTorn]()
+                {
+                    while (!finished)
+                    {
+                        IC::EpochGuard guard(epochAllocator);
+
+                        auto node = shared.load();
+                        auto a = node->m_a;
+                        std::this_thread::yield();
+                        auto b = node->m_b;
+
+                        if (a != b)
+                        {
+                            ++numTorn;
+                        }
+                    }
+                });
+            }
+
+            for (auto i = 1; i <= k_numUpdates; ++i)
+            {
+                auto node = static_cast<ExampleNode*>(epochAllocator.Allocate(sizeof(ExampleNode)));
+                node->m_a = i;
+                node->m_b = i;
+
+                epochAllocator.Deallocate(shared.exchange(node));
+                epochAllocator.Reclaim();
+            }
+
+            finished = true;
+            for (auto& reader : readers)
+            {
+                reader.join();
+            }
+
+            epochAllocator.Deallocate(shared.load());
+            epochAllocator.Reclaim();
+
+            REQUIRE(numTorn == 0);
+            REQUIRE(epochAllocator.GetNumDeferred() == 0);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,233 @@
+// Created by Ian Copland on 2026-10-18
+//
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../ICMemory/ICMemory.h"
+
+#include <catch.hpp>
+#include <unordered_set>
+
+namespace ICMemoryTest
+{
+    namespace
+    {
+        constexpr std::size_t k_linearAllocatorBufferSize = 4 * 1024;
+        constexpr std::size_t k_buddyAllocatorBufferSize = 2048;
+        constexpr std::size_t k_buddyAllocatorMinBlockSize = 16;
+    }
+
+    /// A series of unit tests for flat hash sets allocated from the memory pools.
+    ///
+    TEST_CASE("FlatHashSet", "[Container]")
+    {
+        /// Confirms that an empty set can be allocated from the Buddy Allocator.
+        ///
+        SECTION("MakeEmptyBuddyAllocator")
+        {
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            auto set = IC::MakeFlatHashSet<int>(allocator);
+            set.insert(5);
+            set.insert(6);
+
+            REQUIRE(set.size() == 2);
+            REQUIRE(set.find(5) != set.end());
+            REQUIRE(set.find(6) != set.end());
+        }
+
+        /// Confirms that an empty set can be allocated from the Linear Allocator.
+        ///
+        SECTION("MakeEmptyLinearAllocator")
+        {
+            IC::LinearAllocator linearAllocator(k_linearAllocatorBufferSize);
+
+            auto set = IC::MakeFlatHashSet<int>(linearAllocator);
+            set.insert(5);
+            set.insert(6);
+
+            REQUIRE(set.size() == 2);
+            REQUIRE(set.find(5) != set.end());
+            REQUIRE(set.find(6) != set.end());
+        }
+
+        /// Confirms that a set can be allocated from the Buddy Allocator with a range.
+        ///
+        SECTION("MakeRangeBuddyAllocator")
+        {
+            const std::unordered_set<int> toCopy = { 5, 6 };
+
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            auto set = IC::MakeFlatHashSet<int>(allocator, toCopy.begin(), toCopy.end());
+
+            REQUIRE(set.size() == 2);
+            REQUIRE(set.find(5) != set.end());
+            REQUIRE(set.find(6) != set.end());
+        }
+
+        /// Confirms that a set can be allocated from the Linear Allocator with a range.
+        ///
+        SECTION("MakeRangeLinearAllocator")
+        {
+            const std::unordered_set<int> toCopy = { 5, 6 };
+
+            IC::LinearAllocator linearAllocator(k_linearAllocatorBufferSize);
+
+            auto set = IC::MakeFlatHashSet<int>(linearAllocator, toCopy.begin(), toCopy.end());
+
+            REQUIRE(set.size() == 2);
+            REQUIRE(set.find(5) != set.end());
+            REQUIRE(set.find(6) != set.end());
+        }
+
+        /// Confirms that a set can be allocated from the Buddy Allocator using a std::unordered_set.
+        ///
+        SECTION("MakeStdUnorderedSetBuddyAllocator")
+        {
+            const std::unordered_set<int> toCopy = { 5, 6 };
+
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            auto set = IC::MakeFlatHashSet<int>(allocator, toCopy);
+
+            REQUIRE(set.size() == 2);
+            REQUIRE(set.find(5) != set.end());
+            REQUIRE(set.find(6) != set.end());
+        }
+
+        /// Confirms that a set can be allocated from the Linear Allocator using a std::unordered_set.
+        ///
+        SECTION("MakeStdUnorderedSetLinearAllocator")
+        {
+            const std::unordered_set<int> toCopy = { 5, 6 };
+
+            IC::LinearAllocator linearAllocator(k_linearAllocatorBufferSize);
+
+            auto set = IC::MakeFlatHashSet<int>(linearAllocator, toCopy);
+
+            REQUIRE(set.size() == 2);
+            REQUIRE(set.find(5) != set.end());
+            REQUIRE(set.find(6) != set.end());
+        }
+
+        /// Confirms that erased values can no longer be found and that the remaining values are unaffected.
+        ///
+        SECTION("Erase")
+        {
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            auto set = IC::MakeFlatHashSet<int>(allocator);
+            set.insert(5);
+            set.insert(6);
+            set.insert(7);
+
+            REQUIRE(set.erase(6) == 1);
+            REQUIRE(set.erase(6) == 0);
+
+            REQUIRE(set.size() == 2);
+            REQUIRE(set.find(5) != set.end());
+            REQUIRE(set.find(6) == set.end());
+            REQUIRE(set.find(7) != set.end());
+        }
+
+        /// Confirms that values displaced by collisions can still be found after the values ahead of them in the probe sequence have been erased.
+        ///
+        SECTION("EraseDisplaced")
+        {
+            constexpr int k_numValues = 64;
+
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            auto set = IC::MakeFlatHashSet<int>(allocator);
+            for (auto i = 0; i < k_numValues; ++i)
+            {
+                set.insert(i);
+            }
+
+            for (auto i = 0; i < k_numValues; i += 2)
+            {
+                set.erase(i);
+            }
+
+            REQUIRE(set.size() == k_numValues / 2);
+            for (auto i = 0; i < k_numValues; ++i)
+            {
+                REQUIRE((set.find(i) != set.end()) == (i % 2 == 1));
+            }
+        }
+
+        /// Confirms that repeatedly erasing and inserting values does not leave tombstones behind which would force the set to grow.
+        ///
+        SECTION("EraseInsertCycle")
+        {
+            constexpr int k_numValues = 16;
+            constexpr int k_numCycles = 1000;
+
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            auto set = IC::MakeFlatHashSet<int>(allocator);
+            set.reserve(k_numValues);
+            const auto capacity = set.capacity();
+            const auto allocatedBytes = allocator.GetAllocatedBytes();
+
+            for (auto i = 0; i < k_numValues; ++i)
+            {
+                set.insert(i);
+            }
+
+            for (auto i = 0; i < k_numCycles; ++i)
+            {
+                set.erase(i);
+                set.insert(i + k_numValues);
+            }
+
+            REQUIRE(set.size() == k_numValues);
+            REQUIRE(set.capacity() == capacity);
+            REQUIRE(allocator.GetAllocatedBytes() == allocatedBytes);
+        }
+
+        /// Confirms that reserving space for a number of values allows exactly that many values to be inserted without allocating any further memory.
+        ///
+        SECTION("Reserve")
+        {
+            constexpr int k_numValues = 48;
+
+            IC::LinearAllocator linearAllocator(k_linearAllocatorBufferSize);
+
+            auto set = IC::MakeFlatHashSet<int>(linearAllocator);
+            set.reserve(k_numValues);
+            const auto capacity = set.capacity();
+            const auto allocatedBytes = linearAllocator.GetAllocatedBytes();
+
+            for (auto i = 0; i < k_numValues; ++i)
+            {
+                set.insert(i);
+            }
+
+            REQUIRE(capacity >= k_numValues);
+            REQUIRE(set.capacity() == capacity);
+            REQUIRE(linearAllocator.GetAllocatedBytes() == allocatedBytes);
+            REQUIRE(set.size() == k_numValues);
+        }
+    }
+}
\ No newline at end of file
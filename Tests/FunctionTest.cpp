@@ -0,0 +1,182 @@
+// Created by Ian Copland on 2026-10-18
+//
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../ICMemory/ICMemory.h"
+
+#include <catch.hpp>
+#include <array>
+#include <memory>
+#include <utility>
+
+namespace ICMemoryTest
+{
+    namespace
+    {
+        constexpr std::size_t k_buddyAllocatorBufferSize = 2048;
+        constexpr std::size_t k_buddyAllocatorMinBlockSize = 16;
+        constexpr std::size_t k_largeInlineSize = 80;
+
+        using LargeCapture = std::array<std::int64_t, 8>;
+
+        /// Creates a capture which is larger than the default inline buffer, but which fits in the large inline buffer.
+        ///
+        /// @return The capture.
+        ///
+        LargeCapture CreateLargeCapture()
+        {
+            LargeCapture capture;
+            for (std::size_t i = 0; i < capture.size(); ++i)
+            {
+                capture[i] = static_cast<std::int64_t>(i);
+            }
+
+            return capture;
+        }
+    }
+
+    /// A series of unit tests for functions whose oversized captures are allocated from the memory pools.
+    ///
+    TEST_CASE("Function", "[Container]")
+    {
+        /// Confirms that a function with a small capture can be called without allocating.
+        ///
+        SECTION("SmallCapture")
+        {
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            auto offset = 1;
+            auto function = IC::MakeFunction<int(int)>(allocator, [offset](int value) { return value + offset; });
+
+            REQUIRE(function);
+            REQUIRE(function(1) == 2);
+            REQUIRE(allocator.GetAllocatedBytes() == 0);
+        }
+
+        /// Confirms that a function with a capture larger than the inline buffer spills into the allocator, and returns the memory when destroyed.
+        ///
+        SECTION("LargeCapture")
+        {
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            {
+                auto capture = CreateLargeCapture();
+                auto function = IC::MakeFunction<std::int64_t(std::size_t)>(allocator, [capture](std::size_t index) { return capture[index]; });
+
+                REQUIRE(function(7) == 7);
+                REQUIRE(allocator.GetAllocatedBytes() > 0);
+            }
+
+            REQUIRE(allocator.GetAllocatedBytes() == 0);
+        }
+
+        /// Confirms that a function with a larger inline buffer stores a large capture without allocating.
+        ///
+        SECTION("LargeInlineBuffer")
+        {
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            auto capture = CreateLargeCapture();
+            auto function = IC::MakeFunction<std::int64_t(std::size_t), k_largeInlineSize>(allocator, [capture](std::size_t index) { return capture[index]; });
+
+            REQUIRE(function(7) == 7);
+            REQUIRE(allocator.GetAllocatedBytes() == 0);
+        }
+
+        /// Confirms that copying a function copies its capture.
+        ///
+        SECTION("Copy")
+        {
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            auto count = 0;
+            auto functionA = IC::MakeFunction<int()>(allocator, [count]() mutable { return ++count; });
+            functionA();
+
+            auto functionB = functionA;
+
+            REQUIRE(functionA() == 2);
+            REQUIRE(functionB() == 2);
+        }
+
+        /// Confirms that copying a function with a spilled capture allocates a separate copy of the capture from the
+        /// allocator, and that the two copies are independent.
+        ///
+        SECTION("CopyLargeCapture")
+        {
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            auto capture = CreateLargeCapture();
+            auto functionA = IC::MakeFunction<std::int64_t(std::size_t)>(allocator, [capture](std::size_t index) mutable { return ++capture[index]; });
+            auto allocatedBytes = allocator.GetAllocatedBytes();
+
+            auto functionB = functionA;
+
+            REQUIRE(allocatedBytes > 0);
+            REQUIRE(allocator.GetAllocatedBytes() == allocatedBytes * 2);
+            REQUIRE(functionA(7) == 8);
+            REQUIRE(functionA(7) == 9);
+            REQUIRE(functionB(7) == 8);
+        }
+
+        /// Confirms that moving a function with a spilled capture does not allocate, and leaves the original empty.
+        ///
+        SECTION("Move")
+        {
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            auto capture = CreateLargeCapture();
+            auto functionA = IC::MakeFunction<std::int64_t(std::size_t)>(allocator, [capture](std::size_t index) { return capture[index]; });
+            auto allocatedBytes = allocator.GetAllocatedBytes();
+
+            auto functionB = std::move(functionA);
+
+            REQUIRE(!functionA);
+            REQUIRE(functionB(7) == 7);
+            REQUIRE(allocator.GetAllocatedBytes() == allocatedBytes);
+        }
+
+        /// Confirms that a move only function can hold a capture which cannot be copied.
+        ///
+        SECTION("MoveOnly")
+        {
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            auto value = IC::MakeUnique<int>(allocator, 1);
+            auto functionA = IC::MakeMoveOnlyFunction<int()>(allocator, [value = std::move(value)]() { return *value; });
+            auto functionB = std::move(functionA);
+
+            REQUIRE(!functionA);
+            REQUIRE(functionB() == 1);
+        }
+
+        /// Confirms that a default constructed function is empty.
+        ///
+        SECTION("Empty")
+        {
+            IC::Function<int()> function;
+
+            REQUIRE(!function);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,191 @@
+// Created by Ian Copland on 2026-10-18
+//
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../ICMemory/ICMemory.h"
+
+#include <catch.hpp>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace ICMemoryTest
+{
+    /// A series of unit tests for the global allocator which backs the optional global operator new, operator delete and malloc replacements.
+    ///
+    TEST_CASE("GlobalAllocator", "[Allocator]")
+    {
+        /// Confirms that allocations of a wide range of sizes can be made and written to.
+        ///
+        SECTION("VaryingSizes")
+        {
+            constexpr std::size_t k_maxSize = 1024 * 1024;
+
+            for (std::size_t size = 1; size <= k_maxSize; size *= 2)
+            {
+                auto memory = IC::GlobalAllocate(size);
+                REQUIRE(memory != nullptr);
+
+                std::memset(memory, 0xFF, size);
+                IC::GlobalDeallocate(memory);
+            }
+        }
+
+        /// Confirms that a zero sized allocation results in a unique, non-null pointer.
+        ///
+        SECTION("ZeroSize")
+        {
+            auto memoryA = IC::GlobalAllocate(0);
+            auto memoryB = IC::GlobalAllocate(0);
+
+            REQUIRE(memoryA != nullptr);
+            REQUIRE(memoryB != nullptr);
+            REQUIRE(memoryA != memoryB);
+
+            IC::GlobalDeallocate(memoryA);
+            IC::GlobalDeallocate(memoryB);
+        }
+
+        /// Confirms that allocations honour the requested alignment.
+        ///
+        SECTION("Alignment")
+        {
+            constexpr std::size_t k_size = 24;
+            constexpr std::size_t k_maxAlignment = 4096;
+
+            for (std::size_t alignment = alignof(std::max_align_t); alignment <= k_maxAlignment; alignment *= 2)
+            {
+                auto memory = IC::GlobalAllocate(k_size, alignment);
+
+                REQUIRE(memory != nullptr);
+                REQUIRE(IC::MemoryUtils::IsAligned(memory, alignment));
+
+                IC::GlobalDeallocate(memory);
+            }
+        }
+
+        /// Confirms that reallocating preserves the contents of the original allocation.
+        ///
+        SECTION("Reallocate")
+        {
+            constexpr std::size_t k_initialSize = 16;
+            constexpr std::size_t k_finalSize = 4096;
+
+            auto memory = static_cast<std::uint8_t*>(IC::GlobalAllocate(k_initialSize));
+            REQUIRE(memory != nullptr);
+
+            for (std::size_t i = 0; i < k_initialSize; ++i)
+            {
+                memory[i] = static_cast<std::uint8_t>(i);
+            }
+
+            memory = static_cast<std::uint8_t*>(IC::GlobalReallocate(memory, k_finalSize));
+
+            REQUIRE(memory != nullptr);
+            for (std::size_t i = 0; i < k_initialSize; ++i)
+            {
+                REQUIRE(memory[i] == static_cast<std::uint8_t>(i));
+            }
+
+            IC::GlobalDeallocate(memory);
+        }
+
+        /// Confirms that the usable size of an allocation is at least the requested size.
+        ///
+        SECTION("UsableSize")
+        {
+            constexpr std::size_t k_size = 100;
+
+            auto memory = IC::GlobalAllocate(k_size);
+
+            REQUIRE(IC::GlobalGetUsableSize(memory) >= k_size);
+
+            IC::GlobalDeallocate(memory);
+        }
+
+        /// Confirms that memory allocated on one thread can be deallocated on another.
+        ///
+        SECTION("CrossThreadDeallocation")
+        {
+            constexpr int k_numAllocations = 1000;
+            constexpr std::size_t k_size = 32;
+
+            std::vector<void*> allocations;
+            std::thread producer([&allocations]()
+            {
+                for (auto i = 0; i < k_numAllocations; ++i)
+                {
+                    allocations.push_back(IC::GlobalAllocate(k_size));
+                }
+            });
+            producer.join();
+
+            std::thread consumer([&allocations]()
+            {
+                for (auto memory : allocations)
+                {
+                    IC::GlobalDeallocate(memory);
+                }
+            });
+            consumer.join();
+
+            auto memory = IC::GlobalAllocate(k_size);
+            REQUIRE(memory != nullptr);
+            IC::GlobalDeallocate(memory);
+        }
+
+        /// Confirms that many threads can allocate and deallocate concurrently.
+        ///
+        SECTION("Threaded")
+        {
+            constexpr int k_numThreads = 4;
+            constexpr int k_numAllocations = 10000;
+
+            std::vector<std::thread> threads;
+            std::vector<int> results(k_numThreads, 0);
+            for (auto i = 0; i < k_numThreads; ++i)
+            {
+                threads.emplace_back([&results, i]()
+                {
+                    for (auto j = 0; j < k_numAllocations; ++j)
+                    {
+                        auto memory = static_cast<int*>(IC::GlobalAllocate(sizeof(int) * (1 + j % 16)));
+                        *memory = j;
+                        results[i] += (*memory == j) ? 1 : 0;
+                        IC::GlobalDeallocate(memory);
+                    }
+                });
+            }
+
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            for (auto result : results)
+            {
+                REQUIRE(result == k_numAllocations);
+            }
+        }
+    }
+}
\ No newline at end of file
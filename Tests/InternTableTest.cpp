@@ -0,0 +1,175 @@
+// Created by Ian Copland on 2026-10-18
+//
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../ICMemory/ICMemory.h"
+
+#include <catch.hpp>
+#include <string>
+
+namespace ICMemoryTest
+{
+    namespace
+    {
+        constexpr std::size_t k_buddyAllocatorBufferSize = 2048;
+        constexpr std::size_t k_buddyAllocatorMinBlockSize = 16;
+        constexpr std::size_t k_pageSize = 128;
+    }
+
+    /// A series of unit tests for the InternTable.
+    ///
+    TEST_CASE("InternTable", "[Container]")
+    {
+        /// Confirms that interning the same string twice results in the same id.
+        ///
+        SECTION("SameString")
+        {
+            IC::InternTable internTable;
+
+            auto idA = internTable.Intern("test");
+            auto idB = internTable.Intern("test");
+
+            REQUIRE(idA == idB);
+            REQUIRE(internTable.GetNumStrings() == 1);
+        }
+
+        /// Confirms that interning different strings results in different ids.
+        ///
+        SECTION("DifferentStrings")
+        {
+            IC::InternTable internTable;
+
+            auto idA = internTable.Intern("testA");
+            auto idB = internTable.Intern("testB");
+
+            REQUIRE(idA != idB);
+            REQUIRE(internTable.GetNumStrings() == 2);
+        }
+
+        /// Confirms that the original string can be retrieved from its id.
+        ///
+        SECTION("GetString")
+        {
+            IC::InternTable internTable;
+
+            auto idA = internTable.Intern("testA");
+            auto idB = internTable.Intern("testB");
+
+            REQUIRE(internTable.GetString(idA) == "testA");
+            REQUIRE(internTable.GetString(idB) == "testB");
+        }
+
+        /// Confirms that each unique string is only stored once.
+        ///
+        SECTION("StoredOnce")
+        {
+            IC::BuddyAllocator buddyAllocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+            IC::InternTable internTable(buddyAllocator, k_pageSize);
+
+            auto idA = internTable.Intern("test");
+            auto allocatedBytes = buddyAllocator.GetAllocatedBytes();
+            auto idB = internTable.Intern(std::string("test"));
+
+            REQUIRE(internTable.GetString(idA).data() == internTable.GetString(idB).data());
+            REQUIRE(buddyAllocator.GetAllocatedBytes() == allocatedBytes);
+        }
+
+        /// Confirms that the interned copy of a string outlives the string it was interned from.
+        ///
+        SECTION("Temporary")
+        {
+            IC::InternTable internTable;
+
+            std::uint32_t id;
+            {
+                std::string temporary = "test";
+                id = internTable.Intern(temporary);
+            }
+
+            REQUIRE(internTable.GetString(id) == "test");
+        }
+
+        /// Confirms that a string which has not been interned cannot be found.
+        ///
+        SECTION("Find")
+        {
+            IC::InternTable internTable;
+
+            auto id = internTable.Intern("testA");
+
+            REQUIRE(internTable.Find("testA") == id);
+            REQUIRE(internTable.Find("testB") == IC::InternTable::k_invalidId);
+        }
+
+        /// Confirms that a string can be interned and found using a precomputed hash.
+        ///
+        SECTION("PrecomputedHash")
+        {
+            IC::InternTable internTable;
+
+            auto hash = IC::InternTable::Hash("test");
+            auto idA = internTable.Intern("test", hash);
+            auto idB = internTable.Intern("test");
+
+            REQUIRE(idA == idB);
+            REQUIRE(internTable.Find("test", hash) == idA);
+        }
+
+        /// Confirms that strings remain valid when the table spans multiple pages.
+        ///
+        SECTION("Paging")
+        {
+            constexpr int k_numStrings = 64;
+
+            IC::InternTable internTable(k_pageSize);
+
+            for (auto i = 0; i < k_numStrings; ++i)
+            {
+                internTable.Intern(std::to_string(i));
+            }
+
+            REQUIRE(internTable.GetNumStrings() == k_numStrings);
+            for (auto i = 0; i < k_numStrings; ++i)
+            {
+                auto id = internTable.Find(std::to_string(i));
+
+                REQUIRE(id != IC::InternTable::k_invalidId);
+                REQUIRE(internTable.GetString(id) == std::to_string(i));
+            }
+        }
+
+        /// Confirms that an InternTable can be backed by a Buddy Allocator.
+        ///
+        SECTION("BuddyAllocatorBacked")
+        {
+            IC::BuddyAllocator buddyAllocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+            IC::InternTable internTable(buddyAllocator, k_pageSize);
+
+            auto idA = internTable.Intern("testA");
+            auto idB = internTable.Intern("testB");
+
+            REQUIRE(internTable.GetString(idA) == "testA");
+            REQUIRE(internTable.GetString(idB) == "testB");
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,205 @@
+// Created by Ian Copland on 2026-10-18
+//
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../ICMemory/ICMemory.h"
+
+#include <catch.hpp>
+
+namespace ICMemoryTest
+{
+    namespace
+    {
+        constexpr std::size_t k_linearAllocatorBufferSize = 4 * 1024;
+        constexpr std::size_t k_buddyAllocatorBufferSize = 2048;
+        constexpr std::size_t k_buddyAllocatorMinBlockSize = 16;
+    }
+
+    /// A series of unit tests for intrusive pointers allocated from the memory pools.
+    ///
+    TEST_CASE("IntrusivePtr", "[Container]")
+    {
+        /// Confirms that an intrusive pointer to a struct instance can be allocated from a Buddy Allocator.
+        ///
+        SECTION("MakeBuddyAllocator")
+        {
+            struct ExampleClass : IC::RefCounted
+            {
+                int m_x, m_y;
+            };
+
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            auto allocated = IC::MakeIntrusive<ExampleClass>(allocator);
+            allocated->m_x = 1;
+            allocated->m_y = 2;
+
+            REQUIRE(allocated->m_x == 1);
+            REQUIRE(allocated->m_y == 2);
+        }
+
+        /// Confirms that an intrusive pointer to a struct instance can be allocated from a Linear Allocator.
+        ///
+        SECTION("MakeLinearAllocator")
+        {
+            struct ExampleClass : IC::RefCounted
+            {
+                int m_x, m_y;
+            };
+
+            IC::LinearAllocator linearAllocator(k_linearAllocatorBufferSize);
+
+            auto allocated = IC::MakeIntrusive<ExampleClass>(linearAllocator);
+            allocated->m_x = 1;
+            allocated->m_y = 2;
+
+            REQUIRE(allocated->m_x == 1);
+            REQUIRE(allocated->m_y == 2);
+        }
+
+        /// Confirms that an intrusive pointer to a struct instance with a constructor can be allocated.
+        ///
+        SECTION("MakeConstructor")
+        {
+            struct ExampleClass : IC::RefCounted
+            {
+                ExampleClass(int x, int y) : m_x(x), m_y(y) {}
+                int m_x, m_y;
+            };
+
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            auto allocated = IC::MakeIntrusive<ExampleClass>(allocator, 1, 2);
+
+            REQUIRE(allocated->m_x == 1);
+            REQUIRE(allocated->m_y == 2);
+        }
+
+        /// Confirms that the object and its reference count are placed in a single allocation. The Block Allocator only has a single block, so a separate control block could not be allocated.
+        ///
+        SECTION("SingleAllocation")
+        {
+            constexpr std::size_t k_blockSize = 32;
+            constexpr std::size_t k_numBlocks = 1;
+
+            struct ExampleClass : IC::RefCounted
+            {
+                ExampleClass(int x, int y) : m_x(x), m_y(y) {}
+                int m_x, m_y;
+            };
+
+            IC::BlockAllocator blockAllocator(k_blockSize, k_numBlocks);
+
+            auto allocated = IC::MakeIntrusive<ExampleClass>(blockAllocator, 1, 2);
+
+            REQUIRE(allocated->m_x == 1);
+            REQUIRE(allocated->m_y == 2);
+        }
+
+        /// Confirms that copying and resetting intrusive pointers updates the reference count stored in the object.
+        ///
+        SECTION("RefCount")
+        {
+            struct ExampleClass : IC::RefCounted
+            {
+                int m_x, m_y;
+            };
+
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            auto allocatedA = IC::MakeIntrusive<ExampleClass>(allocator);
+            REQUIRE(allocatedA->GetRefCount() == 1);
+
+            auto allocatedB = allocatedA;
+            REQUIRE(allocatedA->GetRefCount() == 2);
+
+            auto allocatedC = std::move(allocatedB);
+            REQUIRE(allocatedA->GetRefCount() == 2);
+
+            allocatedC.reset();
+            REQUIRE(allocatedA->GetRefCount() == 1);
+        }
+
+        /// Confirms that an intrusive pointer created from a raw pointer shares the reference count of the existing intrusive pointers.
+        ///
+        SECTION("FromRawPointer")
+        {
+            struct ExampleClass : IC::RefCounted
+            {
+                int m_x, m_y;
+            };
+
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            auto allocatedA = IC::MakeIntrusive<ExampleClass>(allocator);
+            IC::IntrusivePtr<ExampleClass> allocatedB(allocatedA.get());
+
+            REQUIRE(allocatedA == allocatedB);
+            REQUIRE(allocatedA->GetRefCount() == 2);
+        }
+
+        /// Confirms that the object is destroyed when the last intrusive pointer to it is released.
+        ///
+        SECTION("Destruction")
+        {
+            struct ExampleClass : IC::RefCounted
+            {
+                ExampleClass(bool& destroyed) : m_destroyed(destroyed) {}
+                ~ExampleClass() { m_destroyed = true; }
+                bool& m_destroyed;
+            };
+
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            bool destroyed = false;
+            auto allocatedA = IC::MakeIntrusive<ExampleClass>(allocator, destroyed);
+            auto allocatedB = allocatedA;
+
+            allocatedA.reset();
+            REQUIRE(!destroyed);
+
+            allocatedB.reset();
+            REQUIRE(destroyed);
+        }
+
+        /// Confirms that an intrusive pointer to a struct instance with a non-atomic reference count can be allocated and reference counted.
+        ///
+        SECTION("LocalRefCounted")
+        {
+            struct ExampleClass : IC::LocalRefCounted
+            {
+                ExampleClass(int x, int y) : m_x(x), m_y(y) {}
+                int m_x, m_y;
+            };
+
+            IC::LinearAllocator linearAllocator(k_linearAllocatorBufferSize);
+
+            auto allocatedA = IC::MakeIntrusive<ExampleClass>(linearAllocator, 1, 2);
+            auto allocatedB = allocatedA;
+
+            REQUIRE(allocatedB->m_x == 1);
+            REQUIRE(allocatedB->m_y == 2);
+            REQUIRE(allocatedA->GetRefCount() == 2);
+        }
+    }
+}
\ No newline at end of file
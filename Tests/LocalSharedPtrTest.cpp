@@ -0,0 +1,196 @@
+// Created by Ian Copland on 2026-10-18
+//
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../ICMemory/ICMemory.h"
+
+#include <catch.hpp>
+
+namespace ICMemoryTest
+{
+    namespace
+    {
+        constexpr std::size_t k_defaultBufferSize = 4 * 1024;
+    }
+
+    /// A series of unit tests for local shared pointers allocated from the memory pools.
+    ///
+    TEST_CASE("LocalSharedPtr", "[Container]")
+    {
+        /// Confirms that a local shared pointer to a fundamental can be allocated from a LinearAllocator.
+        ///
+        SECTION("LocalSharedFundamental")
+        {
+            IC::LinearAllocator linearAllocator(k_defaultBufferSize);
+
+            auto allocated = IC::MakeLocalShared<int>(linearAllocator);
+            *allocated = 1;
+
+            REQUIRE(*allocated == 1);
+        }
+
+        /// Confirms that a local shared pointer to a fundamental with an initial value can be allocated from a LinearAllocator.
+        ///
+        SECTION("LocalSharedFundamentalInitialValue")
+        {
+            IC::LinearAllocator linearAllocator(k_defaultBufferSize);
+
+            auto allocated = IC::MakeLocalShared<int>(linearAllocator, 1);
+
+            REQUIRE(*allocated == 1);
+        }
+
+        /// Confirms that a local shared pointer to a struct instance with a constructor can be allocated from a LinearAllocator.
+        ///
+        SECTION("LocalSharedStructConstructor")
+        {
+            struct ExampleClass
+            {
+                ExampleClass(int x, int y) : m_x(x), m_y(y) {}
+                int m_x, m_y;
+            };
+
+            IC::LinearAllocator linearAllocator(k_defaultBufferSize);
+
+            auto allocated = IC::MakeLocalShared<ExampleClass>(linearAllocator, 1, 2);
+
+            REQUIRE(allocated->m_x == 1);
+            REQUIRE(allocated->m_y == 2);
+        }
+
+        /// Confirms that a local shared pointer to a struct instance can be copy constructed from a LinearAllocator.
+        ///
+        SECTION("LocalSharedStructCopyConstructor")
+        {
+            struct ExampleClass
+            {
+                int m_x, m_y;
+            };
+
+            ExampleClass exampleClass;
+            exampleClass.m_x = 1;
+            exampleClass.m_y = 2;
+
+            IC::LinearAllocator linearAllocator(k_defaultBufferSize);
+
+            auto allocated = IC::MakeLocalShared<ExampleClass>(linearAllocator, exampleClass);
+
+            REQUIRE(allocated->m_x == 1);
+            REQUIRE(allocated->m_y == 2);
+        }
+
+        /// Confirms that a local shared pointer can be allocated from a SmallObjectAllocator.
+        ///
+        SECTION("SmallObjectAllocator")
+        {
+            IC::SmallObjectAllocator smallObjectAllocator(k_defaultBufferSize);
+
+            auto allocated = IC::MakeLocalShared<int>(smallObjectAllocator, 1);
+
+            REQUIRE(*allocated == 1);
+        }
+
+        /// Confirms that the object and its control block are placed in a single allocation. The Block Allocator only has a single block, so a separate control block could not be allocated.
+        ///
+        SECTION("SingleAllocation")
+        {
+            constexpr std::size_t k_blockSize = 32;
+            constexpr std::size_t k_numBlocks = 1;
+
+            IC::BlockAllocator blockAllocator(k_blockSize, k_numBlocks);
+
+            auto allocated = IC::MakeLocalShared<int>(blockAllocator, 1);
+
+            REQUIRE(*allocated == 1);
+        }
+
+        /// Confirms that copying and resetting local shared pointers updates the use count.
+        ///
+        SECTION("UseCount")
+        {
+            IC::LinearAllocator linearAllocator(k_defaultBufferSize);
+
+            auto allocatedA = IC::MakeLocalShared<int>(linearAllocator, 1);
+            REQUIRE(allocatedA.use_count() == 1);
+
+            auto allocatedB = allocatedA;
+            REQUIRE(allocatedA.use_count() == 2);
+
+            auto allocatedC = std::move(allocatedB);
+            REQUIRE(allocatedA.use_count() == 2);
+
+            allocatedC.reset();
+            REQUIRE(allocatedA.use_count() == 1);
+        }
+
+        /// Confirms that the object is destroyed when the last local shared pointer to it is released.
+        ///
+        SECTION("Destruction")
+        {
+            struct ExampleClass
+            {
+                ExampleClass(bool& destroyed) : m_destroyed(destroyed) {}
+                ~ExampleClass() { m_destroyed = true; }
+                bool& m_destroyed;
+            };
+
+            IC::LinearAllocator linearAllocator(k_defaultBufferSize);
+
+            bool destroyed = false;
+            auto allocatedA = IC::MakeLocalShared<ExampleClass>(linearAllocator, destroyed);
+            auto allocatedB = allocatedA;
+
+            allocatedA.reset();
+            REQUIRE(!destroyed);
+
+            allocatedB.reset();
+            REQUIRE(destroyed);
+        }
+
+        /// Confirms that a local shared pointer can be explicitly converted to a shared pointer which keeps the object alive.
+        ///
+        SECTION("ToShared")
+        {
+            struct ExampleClass
+            {
+                ExampleClass(bool& destroyed) : m_destroyed(destroyed) {}
+                ~ExampleClass() { m_destroyed = true; }
+                bool& m_destroyed;
+            };
+
+            IC::LinearAllocator linearAllocator(k_defaultBufferSize);
+
+            bool destroyed = false;
+            auto local = IC::MakeLocalShared<ExampleClass>(linearAllocator, destroyed);
+
+            IC::SharedPtr<ExampleClass> shared = local.ToShared();
+            REQUIRE(shared.get() == local.get());
+
+            local.reset();
+            REQUIRE(!destroyed);
+
+            shared.reset();
+            REQUIRE(destroyed);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,228 @@
+// Created by Ian Copland on 2026-10-18
+//
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../ICMemory/ICMemory.h"
+
+#include <catch.hpp>
+#include <cstdio>
+
+namespace ICMemoryTest
+{
+    namespace
+    {
+        constexpr char k_filePath[] = "MappedAllocatorTest.bin";
+        constexpr std::size_t k_bufferSize = 64 * 1024;
+        constexpr std::size_t k_buddyAllocatorMinBlockSize = 16;
+    }
+
+    /// A series of unit tests for allocators backed by memory mapped files, and the offset pointers and containers which allow data structures built in them to be remapped at a different address.
+    ///
+    TEST_CASE("MappedAllocator", "[Allocator]")
+    {
+        /// Confirms that an offset pointer can be dereferenced.
+        ///
+        SECTION("OffsetPtr")
+        {
+            struct ExampleClass
+            {
+                int m_x, m_y;
+            };
+
+            ExampleClass exampleClass;
+            exampleClass.m_x = 1;
+            exampleClass.m_y = 2;
+
+            IC::OffsetPtr<ExampleClass> pointer(&exampleClass);
+
+            REQUIRE(pointer.get() == &exampleClass);
+            REQUIRE(pointer->m_x == 1);
+            REQUIRE((*pointer).m_y == 2);
+        }
+
+        /// Confirms that a copied offset pointer points to the same object, even though it is stored at a different address.
+        ///
+        SECTION("OffsetPtrCopy")
+        {
+            int value = 1;
+
+            IC::OffsetPtr<int> pointerA(&value);
+            IC::OffsetPtr<int> pointerB;
+            pointerB = pointerA;
+
+            REQUIRE(pointerB.get() == &value);
+            REQUIRE(pointerA == pointerB);
+        }
+
+        /// Confirms that a default constructed offset pointer is null.
+        ///
+        SECTION("OffsetPtrNull")
+        {
+            IC::OffsetPtr<int> pointer;
+
+            REQUIRE(pointer == nullptr);
+            REQUIRE(!pointer);
+        }
+
+        /// Confirms that objects can be allocated from a MappedLinearAllocator.
+        ///
+        SECTION("MappedLinearAllocator")
+        {
+            std::remove(k_filePath);
+
+            {
+                IC::MappedLinearAllocator allocator(k_filePath, k_bufferSize);
+
+                auto valueA = IC::MakeUnique<int>(allocator, 1);
+                auto valueB = IC::MakeUnique<int>(allocator, 2);
+
+                REQUIRE(*valueA == 1);
+                REQUIRE(*valueB == 2);
+            }
+
+            std::remove(k_filePath);
+        }
+
+        /// Confirms that objects can be allocated and deallocated from a MappedBuddyAllocator.
+        ///
+        SECTION("MappedBuddyAllocator")
+        {
+            std::remove(k_filePath);
+
+            {
+                IC::MappedBuddyAllocator allocator(k_filePath, k_bufferSize, k_buddyAllocatorMinBlockSize);
+
+                auto valueA = IC::MakeUnique<int>(allocator, 1);
+                auto valueB = IC::MakeUnique<int>(allocator, 2);
+                valueB.reset();
+                auto valueC = IC::MakeUnique<int>(allocator, 3);
+                valueB = IC::MakeUnique<int>(allocator, 4);
+
+                REQUIRE(*valueA == 1);
+                REQUIRE(*valueB == 4);
+                REQUIRE(*valueC == 3);
+            }
+
+            std::remove(k_filePath);
+        }
+
+        /// Confirms that an offset vector built in a MappedLinearAllocator can be read back both through a second mapping of
+        /// the file, which cannot share the address of the still open first mapping, and after the file is reopened.
+        ///
+        SECTION("PersistVector")
+        {
+            constexpr int k_numValues = 100;
+
+            std::remove(k_filePath);
+
+            {
+                IC::MappedLinearAllocator allocator(k_filePath, k_bufferSize);
+
+                auto& vec = IC::MakeOffsetVector<int>(allocator);
+                for (auto i = 0; i < k_numValues; ++i)
+                {
+                    vec.push_back(i);
+                }
+
+                allocator.SetRoot(&vec);
+
+                IC::MappedLinearAllocator remappedAllocator(k_filePath);
+
+                auto remappedVec = remappedAllocator.GetRoot<IC::OffsetVector<int>>();
+
+                REQUIRE(remappedVec != nullptr);
+                REQUIRE(remappedVec != &vec);
+                REQUIRE(remappedVec->size() == k_numValues);
+                for (auto i = 0; i < k_numValues; ++i)
+                {
+                    REQUIRE((*remappedVec)[i] == i);
+                }
+            }
+
+            {
+                IC::MappedLinearAllocator allocator(k_filePath);
+
+                auto vec = allocator.GetRoot<IC::OffsetVector<int>>();
+
+                REQUIRE(vec != nullptr);
+                REQUIRE(vec->size() == k_numValues);
+                for (auto i = 0; i < k_numValues; ++i)
+                {
+                    REQUIRE((*vec)[i] == i);
+                }
+            }
+
+            std::remove(k_filePath);
+        }
+
+        /// Confirms that an offset unordered map built in a MappedBuddyAllocator can be read back both through a second
+        /// mapping of the file, which cannot share the address of the still open first mapping, and after the file is
+        /// reopened.
+        ///
+        SECTION("PersistUnorderedMap")
+        {
+            constexpr int k_numValues = 100;
+
+            std::remove(k_filePath);
+
+            {
+                IC::MappedBuddyAllocator allocator(k_filePath, k_bufferSize, k_buddyAllocatorMinBlockSize);
+
+                auto& map = IC::MakeOffsetUnorderedMap<int, int>(allocator);
+                for (auto i = 0; i < k_numValues; ++i)
+                {
+                    map.emplace(i, i * 2);
+                }
+
+                allocator.SetRoot(&map);
+
+                IC::MappedBuddyAllocator remappedAllocator(k_filePath);
+
+                auto remappedMap = remappedAllocator.GetRoot<IC::OffsetUnorderedMap<int, int>>();
+
+                REQUIRE(remappedMap != nullptr);
+                REQUIRE(remappedMap != &map);
+                REQUIRE(remappedMap->size() == k_numValues);
+                for (auto i = 0; i < k_numValues; ++i)
+                {
+                    REQUIRE(remappedMap->at(i) == i * 2);
+                }
+            }
+
+            {
+                IC::MappedBuddyAllocator allocator(k_filePath);
+
+                auto map = allocator.GetRoot<IC::OffsetUnorderedMap<int, int>>();
+
+                REQUIRE(map != nullptr);
+                REQUIRE(map->size() == k_numValues);
+                for (auto i = 0; i < k_numValues; ++i)
+                {
+                    REQUIRE(map->at(i) == i * 2);
+                }
+            }
+
+            std::remove(k_filePath);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,207 @@
+// Created by Ian Copland on 2026-10-18
+//
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../ICMemory/ICMemory.h"
+
+#include <catch.hpp>
+#include <vector>
+
+namespace ICMemoryTest
+{
+    namespace
+    {
+        constexpr std::size_t k_buddyAllocatorBufferSize = 4096;
+        constexpr std::size_t k_buddyAllocatorMinBlockSize = 16;
+        constexpr std::size_t k_blockSize = 64;
+        constexpr std::size_t k_softLimit = k_blockSize * 4;
+        constexpr std::size_t k_hardLimit = k_blockSize * 8;
+    }
+
+    /// A series of unit tests for allocator limits and memory pressure callbacks.
+    ///
+    TEST_CASE("MemoryPressure", "[Allocator]")
+    {
+        /// Confirms that the number of allocated bytes is tracked. Usage is the size of the blocks handed out, so a power
+        /// of two request no smaller than the minimum block size is counted exactly. Every limit in these tests relies on
+        /// this.
+        ///
+        SECTION("AllocatedBytes")
+        {
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            REQUIRE(allocator.GetAllocatedBytes() == 0);
+
+            auto memory = allocator.Allocate(k_blockSize);
+            REQUIRE(allocator.GetAllocatedBytes() == k_blockSize);
+
+            allocator.Deallocate(memory);
+            REQUIRE(allocator.GetAllocatedBytes() == 0);
+        }
+
+        /// Confirms that a pressure callback is invoked once when usage crosses the soft limit.
+        ///
+        SECTION("SoftLimit")
+        {
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+            allocator.SetSoftLimit(k_softLimit);
+
+            std::vector<IC::PressureLevel> levels;
+            allocator.RegisterPressureCallback([&levels](IC::PressureLevel level)
+            {
+                levels.push_back(level);
+            });
+
+            std::vector<void*> allocations;
+            for (std::size_t i = 0; i < k_softLimit / k_blockSize; ++i)
+            {
+                allocations.push_back(allocator.Allocate(k_blockSize));
+            }
+
+            REQUIRE(levels.empty());
+
+            allocations.push_back(allocator.Allocate(k_blockSize));
+            allocations.push_back(allocator.Allocate(k_blockSize));
+
+            REQUIRE(levels.size() == 1);
+            REQUIRE(levels[0] == IC::PressureLevel::k_soft);
+
+            for (auto memory : allocations)
+            {
+                allocator.Deallocate(memory);
+            }
+        }
+
+        /// Confirms that a callback can free memory when the hard limit would be exceeded, allowing the allocation to succeed.
+        ///
+        SECTION("HardLimitEviction")
+        {
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+            allocator.SetHardLimit(k_hardLimit);
+
+            std::vector<void*> cache;
+            allocator.RegisterPressureCallback([&allocator, &cache](IC::PressureLevel level)
+            {
+                if (level == IC::PressureLevel::k_hard && !cache.empty())
+                {
+                    allocator.Deallocate(cache.back());
+                    cache.pop_back();
+                }
+            });
+
+            for (std::size_t i = 0; i < k_hardLimit / k_blockSize; ++i)
+            {
+                cache.push_back(allocator.Allocate(k_blockSize));
+            }
+
+            auto memory = allocator.Allocate(k_blockSize);
+
+            REQUIRE(memory != nullptr);
+            REQUIRE(cache.size() == k_hardLimit / k_blockSize - 1);
+            REQUIRE(allocator.GetAllocatedBytes() == k_hardLimit);
+
+            allocator.Deallocate(memory);
+            for (auto cached : cache)
+            {
+                allocator.Deallocate(cached);
+            }
+        }
+
+        /// Confirms that an allocation which would exceed the hard limit fails predictably when nothing can be freed.
+        ///
+        SECTION("HardLimitExceeded")
+        {
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+            allocator.SetHardLimit(k_hardLimit);
+
+            std::vector<void*> allocations;
+            for (std::size_t i = 0; i < k_hardLimit / k_blockSize; ++i)
+            {
+                allocations.push_back(allocator.Allocate(k_blockSize));
+            }
+
+            REQUIRE(allocator.TryAllocate(k_blockSize) == nullptr);
+
+            for (auto memory : allocations)
+            {
+                allocator.Deallocate(memory);
+            }
+        }
+
+        /// Confirms that a callback is no longer invoked once it has been unregistered.
+        ///
+        SECTION("Unregister")
+        {
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+            allocator.SetSoftLimit(k_blockSize);
+
+            auto numCalls = 0;
+            auto id = allocator.RegisterPressureCallback([&numCalls](IC::PressureLevel)
+            {
+                ++numCalls;
+            });
+            allocator.UnregisterPressureCallback(id);
+
+            auto memoryA = allocator.Allocate(k_blockSize);
+            auto memoryB = allocator.Allocate(k_blockSize);
+
+            REQUIRE(numCalls == 0);
+
+            allocator.Deallocate(memoryA);
+            allocator.Deallocate(memoryB);
+        }
+
+        /// Confirms that a budget shared by multiple allocators limits their combined usage.
+        ///
+        SECTION("SharedBudget")
+        {
+            IC::MemoryBudget budget(k_hardLimit);
+
+            IC::BuddyAllocator allocatorA(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+            IC::BuddyAllocator allocatorB(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+            allocatorA.SetBudget(budget);
+            allocatorB.SetBudget(budget);
+
+            std::vector<void*> allocationsA;
+            for (std::size_t i = 0; i < k_hardLimit / k_blockSize; ++i)
+            {
+                allocationsA.push_back(allocatorA.Allocate(k_blockSize));
+            }
+
+            REQUIRE(budget.GetAllocatedBytes() == k_hardLimit);
+            REQUIRE(allocatorB.TryAllocate(k_blockSize) == nullptr);
+
+            allocatorA.Deallocate(allocationsA.back());
+            allocationsA.pop_back();
+
+            auto memoryB = allocatorB.TryAllocate(k_blockSize);
+            REQUIRE(memoryB != nullptr);
+
+            allocatorB.Deallocate(memoryB);
+            for (auto memory : allocationsA)
+            {
+                allocatorA.Deallocate(memory);
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,152 @@
+// Created by Ian Copland on 2026-10-18
+//
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../ICMemory/ICMemory.h"
+
+#include <catch.hpp>
+
+// std::pmr requires C++17, which the v140 toolset does not provide, so these tests are only built against a newer
+// language standard.
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+namespace ICMemoryTest
+{
+    namespace
+    {
+        constexpr std::size_t k_linearAllocatorBufferSize = 4 * 1024;
+        constexpr std::size_t k_buddyAllocatorBufferSize = 2048;
+        constexpr std::size_t k_buddyAllocatorMinBlockSize = 16;
+    }
+
+    /// A series of unit tests for the adapters between allocators and std::pmr memory resources.
+    ///
+    TEST_CASE("MemoryResourceAdapter", "[Allocator]")
+    {
+        /// Confirms that a pmr vector can be allocated from a Buddy Allocator.
+        ///
+        SECTION("PmrVectorBuddyAllocator")
+        {
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+            IC::MemoryResourceAdapter memoryResource(allocator);
+
+            std::pmr::vector<int> vec(&memoryResource);
+            vec.push_back(5);
+            vec.push_back(6);
+
+            REQUIRE(vec.size() == 2);
+            REQUIRE(vec[0] == 5);
+            REQUIRE(vec[1] == 6);
+        }
+
+        /// Confirms that a pmr vector can be allocated from a Linear Allocator.
+        ///
+        SECTION("PmrVectorLinearAllocator")
+        {
+            IC::LinearAllocator linearAllocator(k_linearAllocatorBufferSize);
+            IC::MemoryResourceAdapter memoryResource(linearAllocator);
+
+            std::pmr::vector<int> vec(&memoryResource);
+            vec.push_back(5);
+            vec.push_back(6);
+
+            REQUIRE(vec.size() == 2);
+            REQUIRE(vec[0] == 5);
+            REQUIRE(vec[1] == 6);
+        }
+
+        /// Confirms that a pmr string can be allocated from a Paged Linear Allocator.
+        ///
+        SECTION("PmrStringPagedLinearAllocator")
+        {
+            constexpr char k_testString[] = "GVFuEQyRi*wIn#LAVl@5LWTLqKitenElz#EKiSMf#DW!wsa5Ev#xLxs(LH&IZku";
+
+            IC::PagedLinearAllocator pagedLinearAllocator;
+            IC::MemoryResourceAdapter memoryResource(pagedLinearAllocator);
+
+            std::pmr::string string(k_testString, &memoryResource);
+
+            REQUIRE(string == k_testString);
+        }
+
+        /// Confirms that memory resource adapters are only equal if they wrap the same allocator.
+        ///
+        SECTION("IsEqual")
+        {
+            IC::BuddyAllocator allocatorA(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+            IC::BuddyAllocator allocatorB(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+            IC::MemoryResourceAdapter memoryResourceA(allocatorA);
+            IC::MemoryResourceAdapter memoryResourceA2(allocatorA);
+            IC::MemoryResourceAdapter memoryResourceB(allocatorB);
+
+            REQUIRE(memoryResourceA.is_equal(memoryResourceA2));
+            REQUIRE(!memoryResourceA.is_equal(memoryResourceB));
+        }
+
+        /// Confirms that a unique pointer can be allocated from an allocator which wraps a memory resource.
+        ///
+        SECTION("UniqueMemoryResourceAllocator")
+        {
+            IC::MemoryResourceAllocator allocator(*std::pmr::new_delete_resource());
+
+            auto allocated = IC::MakeUnique<int>(allocator, 1);
+
+            REQUIRE(*allocated == 1);
+        }
+
+        /// Confirms that a vector can be allocated from an allocator which wraps a monotonic buffer resource.
+        ///
+        SECTION("VectorMemoryResourceAllocator")
+        {
+            std::pmr::monotonic_buffer_resource monotonicBufferResource;
+            IC::MemoryResourceAllocator allocator(monotonicBufferResource);
+
+            auto vec = IC::MakeVector<int>(allocator);
+            vec.push_back(5);
+            vec.push_back(6);
+
+            REQUIRE(vec.size() == 2);
+            REQUIRE(vec[0] == 5);
+            REQUIRE(vec[1] == 6);
+        }
+
+        /// Confirms that an allocator can round trip through a memory resource adapter and back.
+        ///
+        SECTION("RoundTrip")
+        {
+            IC::BuddyAllocator buddyAllocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+            IC::MemoryResourceAdapter memoryResource(buddyAllocator);
+            IC::MemoryResourceAllocator allocator(memoryResource);
+
+            auto allocated = IC::MakeShared<int>(allocator, 1);
+
+            REQUIRE(*allocated == 1);
+        }
+    }
+}
+
+#endif
\ No newline at end of file
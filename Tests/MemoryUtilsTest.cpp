@@ -0,0 +1,266 @@
+// Created by Ian Copland on 2026-10-18
+//
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../ICMemory/ICMemory.h"
+
+#include <catch.hpp>
+#include <algorithm>
+#include <vector>
+
+namespace ICMemoryTest
+{
+    namespace
+    {
+        constexpr std::size_t k_maxSmallSize = 300;
+        constexpr std::size_t k_maxOffset = 64;
+        constexpr std::size_t k_largeSize = 4 * 1024 * 1024;
+        constexpr std::uint8_t k_poison = 0xCD;
+
+        /// @return Every SIMD level supported by the hardware, from no SIMD up to and including the highest supported level.
+        ///
+        std::vector<IC::MemoryUtils::SimdLevel> GetSupportedSimdLevels()
+        {
+            const IC::MemoryUtils::SimdLevel k_allSimdLevels[] =
+            {
+                IC::MemoryUtils::SimdLevel::k_none,
+                IC::MemoryUtils::SimdLevel::k_sse2,
+                IC::MemoryUtils::SimdLevel::k_avx2,
+                IC::MemoryUtils::SimdLevel::k_avx512
+            };
+
+            std::vector<IC::MemoryUtils::SimdLevel> simdLevels;
+            for (auto simdLevel : k_allSimdLevels)
+            {
+                if (simdLevel <= IC::MemoryUtils::GetMaxSimdLevel())
+                {
+                    simdLevels.push_back(simdLevel);
+                }
+            }
+
+            return simdLevels;
+        }
+
+        /// Forces the bulk memory operations to use the given SIMD level for the lifetime of the object, restoring
+        /// the highest supported level on destruction.
+        ///
+        class ScopedSimdLevel final
+        {
+        public:
+            /// @param simdLevel
+            ///     The SIMD level to use. Must be supported by the hardware.
+            ///
+            ScopedSimdLevel(IC::MemoryUtils::SimdLevel simdLevel)
+            {
+                IC::MemoryUtils::SetSimdLevel(simdLevel);
+            }
+
+            ~ScopedSimdLevel()
+            {
+                IC::MemoryUtils::SetSimdLevel(IC::MemoryUtils::GetMaxSimdLevel());
+            }
+        };
+    }
+
+    /// A series of unit tests for the bulk memory operations in MemoryUtils. Each operation is tested at every SIMD level
+    /// supported by the hardware, and small sizes are tested at every offset within a cache line, so that the head and
+    /// tail handling of each vector width is covered.
+    ///
+    TEST_CASE("MemoryUtils", "[Utility]")
+    {
+        /// Confirms that the active SIMD level defaults to the highest level supported by the hardware, that SSE2 is always
+        /// reported on x64 and that the active level can be forced to any supported level.
+        ///
+        SECTION("SimdLevel")
+        {
+            auto maxSimdLevel = IC::MemoryUtils::GetMaxSimdLevel();
+
+            REQUIRE(IC::MemoryUtils::GetSimdLevel() == maxSimdLevel);
+#if defined(_M_X64) || defined(__x86_64__)
+            REQUIRE(maxSimdLevel >= IC::MemoryUtils::SimdLevel::k_sse2);
+#endif
+
+            for (auto simdLevel : GetSupportedSimdLevels())
+            {
+                ScopedSimdLevel scopedSimdLevel(simdLevel);
+
+                REQUIRE(IC::MemoryUtils::GetSimdLevel() == simdLevel);
+            }
+
+            REQUIRE(IC::MemoryUtils::GetSimdLevel() == maxSimdLevel);
+        }
+
+        /// Confirms that zeroing only writes to the requested range.
+        ///
+        SECTION("Zero")
+        {
+            for (auto simdLevel : GetSupportedSimdLevels())
+            {
+                ScopedSimdLevel scopedSimdLevel(simdLevel);
+                INFO("SIMD level " << static_cast<int>(simdLevel));
+
+                std::vector<std::uint8_t> buffer(k_maxSmallSize + k_maxOffset * 2);
+
+                for (std::size_t offset = 0; offset < k_maxOffset; ++offset)
+                {
+                    for (std::size_t size = 0; size <= k_maxSmallSize; ++size)
+                    {
+                        std::fill(buffer.begin(), buffer.end(), k_poison);
+
+                        IC::MemoryUtils::Zero(buffer.data() + offset, size);
+
+                        for (std::size_t i = 0; i < buffer.size(); ++i)
+                        {
+                            auto inRange = i >= offset && i < offset + size;
+                            if (buffer[i] != (inRange ? 0 : k_poison))
+                            {
+                                FAIL("Incorrect byte at index " << i << " for offset " << offset << " and size " << size);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        /// Confirms that filling with a pattern repeats the pattern across the requested range only.
+        ///
+        SECTION("Fill")
+        {
+            constexpr std::uint32_t k_pattern = 0x01234567;
+
+            for (auto simdLevel : GetSupportedSimdLevels())
+            {
+                ScopedSimdLevel scopedSimdLevel(simdLevel);
+                INFO("SIMD level " << static_cast<int>(simdLevel));
+
+                std::vector<std::uint32_t> buffer(k_maxSmallSize + 2);
+
+                for (std::size_t count = 0; count <= k_maxSmallSize; ++count)
+                {
+                    std::fill(buffer.begin(), buffer.end(), 0);
+
+                    IC::MemoryUtils::Fill(buffer.data() + 1, count, k_pattern);
+
+                    REQUIRE(buffer[0] == 0);
+                    REQUIRE(buffer[count + 1] == 0);
+                    for (std::size_t i = 1; i <= count; ++i)
+                    {
+                        REQUIRE(buffer[i] == k_pattern);
+                    }
+                }
+            }
+        }
+
+        /// Confirms that copying only writes to the requested range and copies the correct bytes.
+        ///
+        SECTION("Copy")
+        {
+            for (auto simdLevel : GetSupportedSimdLevels())
+            {
+                ScopedSimdLevel scopedSimdLevel(simdLevel);
+                INFO("SIMD level " << static_cast<int>(simdLevel));
+
+                std::vector<std::uint8_t> source(k_maxSmallSize + k_maxOffset);
+                for (std::size_t i = 0; i < source.size(); ++i)
+                {
+                    source[i] = static_cast<std::uint8_t>(i);
+                }
+
+                std::vector<std::uint8_t> destination(k_maxSmallSize + k_maxOffset * 2);
+
+                for (std::size_t offset = 0; offset < k_maxOffset; ++offset)
+                {
+                    for (std::size_t size = 0; size <= k_maxSmallSize; ++size)
+                    {
+                        std::fill(destination.begin(), destination.end(), k_poison);
+
+                        IC::MemoryUtils::Copy(destination.data() + offset, source.data() + (k_maxOffset - 1 - offset), size);
+
+                        for (std::size_t i = 0; i < destination.size(); ++i)
+                        {
+                            auto inRange = i >= offset && i < offset + size;
+                            auto expected = inRange ? source[i - offset + (k_maxOffset - 1 - offset)] : k_poison;
+                            if (destination[i] != expected)
+                            {
+                                FAIL("Incorrect byte at index " << i << " for offset " << offset << " and size " << size);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        /// Confirms that large blocks, which use non-temporal stores, are zeroed and copied correctly.
+        ///
+        SECTION("Large")
+        {
+            for (auto simdLevel : GetSupportedSimdLevels())
+            {
+                ScopedSimdLevel scopedSimdLevel(simdLevel);
+                INFO("SIMD level " << static_cast<int>(simdLevel));
+
+                std::vector<std::uint8_t> source(k_largeSize + 1);
+                for (std::size_t i = 0; i < source.size(); ++i)
+                {
+                    source[i] = static_cast<std::uint8_t>(i * 7);
+                }
+
+                std::vector<std::uint8_t> destination(k_largeSize + 1, k_poison);
+
+                IC::MemoryUtils::Copy(destination.data() + 1, source.data() + 1, k_largeSize);
+                REQUIRE(destination[0] == k_poison);
+                REQUIRE(std::equal(destination.begin() + 1, destination.end(), source.begin() + 1));
+
+                IC::MemoryUtils::Zero(destination.data() + 1, k_largeSize);
+                REQUIRE(destination[0] == k_poison);
+                REQUIRE(std::all_of(destination.begin() + 1, destination.end(), [](std::uint8_t value) { return value == 0; }));
+            }
+        }
+
+        /// Confirms that resetting a Linear Allocator with zeroing leaves subsequent allocations zeroed.
+        ///
+        SECTION("LinearAllocatorResetAndZero")
+        {
+            constexpr std::size_t k_linearAllocatorBufferSize = 4 * 1024;
+            constexpr int k_numValues = 100;
+
+            IC::LinearAllocator linearAllocator(k_linearAllocatorBufferSize);
+
+            {
+                auto dirty = IC::MakeUniqueArray<int>(linearAllocator, k_numValues);
+                for (auto i = 0; i < k_numValues; ++i)
+                {
+                    dirty[i] = -1;
+                }
+            }
+
+            linearAllocator.ResetAndZero();
+
+            auto memory = static_cast<int*>(linearAllocator.Allocate(sizeof(int) * k_numValues));
+            for (auto i = 0; i < k_numValues; ++i)
+            {
+                REQUIRE(memory[i] == 0);
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,173 @@
+// Created by Ian Copland on 2026-10-18
+//
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../ICMemory/ICMemory.h"
+
+#include <catch.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace ICMemoryTest
+{
+    namespace
+    {
+        constexpr std::size_t k_linearAllocatorBufferSize = 4 * 1024;
+        constexpr std::size_t k_buddyAllocatorBufferSize = 2048;
+        constexpr std::size_t k_buddyAllocatorMinBlockSize = 16;
+        constexpr std::size_t k_queueCapacity = 8;
+    }
+
+    /// A series of unit tests for multiple producer, multiple consumer ring queues allocated from the memory pools.
+    ///
+    TEST_CASE("MpmcRingQueue", "[Container]")
+    {
+        /// Confirms that an empty queue can be allocated from the Buddy Allocator.
+        ///
+        SECTION("MakeEmptyBuddyAllocator")
+        {
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            auto queue = IC::MakeMpmcRingQueue<int>(allocator, k_queueCapacity);
+            REQUIRE(queue.TryPush(5));
+            REQUIRE(queue.TryPush(6));
+
+            int value = 0;
+            REQUIRE(queue.TryPop(value));
+            REQUIRE(value == 5);
+            REQUIRE(queue.TryPop(value));
+            REQUIRE(value == 6);
+            REQUIRE(!queue.TryPop(value));
+        }
+
+        /// Confirms that an empty queue can be allocated from the Linear Allocator.
+        ///
+        SECTION("MakeEmptyLinearAllocator")
+        {
+            IC::LinearAllocator linearAllocator(k_linearAllocatorBufferSize);
+
+            auto queue = IC::MakeMpmcRingQueue<int>(linearAllocator, k_queueCapacity);
+            REQUIRE(queue.TryPush(5));
+            REQUIRE(queue.TryPush(6));
+
+            int value = 0;
+            REQUIRE(queue.TryPop(value));
+            REQUIRE(value == 5);
+            REQUIRE(queue.TryPop(value));
+            REQUIRE(value == 6);
+            REQUIRE(!queue.TryPop(value));
+        }
+
+        /// Confirms that the requested capacity is rounded up to a power of two.
+        ///
+        SECTION("Capacity")
+        {
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            auto queue = IC::MakeMpmcRingQueue<int>(allocator, 5);
+
+            REQUIRE(queue.GetCapacity() == 8);
+        }
+
+        /// Confirms that pushing to a full queue fails without overwriting the queued values.
+        ///
+        SECTION("Full")
+        {
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            auto queue = IC::MakeMpmcRingQueue<int>(allocator, k_queueCapacity);
+            for (std::size_t i = 0; i < k_queueCapacity; ++i)
+            {
+                REQUIRE(queue.TryPush(static_cast<int>(i)));
+            }
+
+            REQUIRE(!queue.TryPush(-1));
+
+            int value = -1;
+            REQUIRE(queue.TryPop(value));
+            REQUIRE(value == 0);
+        }
+
+        /// Confirms that every value is received exactly once when multiple producers and consumers run on different threads.
+        ///
+        SECTION("Threaded")
+        {
+            constexpr int k_numThreads = 4;
+            constexpr int k_numValuesPerThread = 25000;
+            constexpr int k_numValues = k_numThreads * k_numValuesPerThread;
+
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            auto queue = IC::MakeMpmcRingQueue<int>(allocator, k_queueCapacity);
+
+            std::vector<std::atomic<int>> received(k_numValues);
+            for (auto& count : received)
+            {
+                count = 0;
+            }
+
+            std::vector<std::thread> threads;
+            for (auto i = 0; i < k_numThreads; ++i)
+            {
+                threads.emplace_back([&queue, i]()
+                {
+                    for (auto j = 0; j < k_numValuesPerThread; ++j)
+                    {
+                        while (!queue.TryPush(i * k_numValuesPerThread + j))
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+                });
+
+                threads.emplace_back([&queue, &received]()
+                {
+                    for (auto j = 0; j < k_numValuesPerThread; ++j)
+                    {
+                        int value = -1;
+                        while (!queue.TryPop(value))
+                        {
+                            std::this_thread::yield();
+                        }
+
+                        ++received[value];
+                    }
+                });
+            }
+
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            auto receivedOnce = true;
+            for (auto& count : received)
+            {
+                receivedOnce = receivedOnce && (count == 1);
+            }
+
+            REQUIRE(receivedOnce);
+        }
+    }
+}
\ No newline at end of file
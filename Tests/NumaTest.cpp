@@ -0,0 +1,176 @@
+// Created by Ian Copland on 2026-10-18
+//
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../ICMemory/ICMemory.h"
+
+#include <catch.hpp>
+#include <algorithm>
+
+namespace ICMemoryTest
+{
+    namespace
+    {
+        // NUMA placement works at OS page granularity, so every buffer and page is a whole number of OS pages. 64 KB
+        // is a multiple of the page size, and of the allocation granularity on Windows, on every supported platform.
+        constexpr std::size_t k_buddyAllocatorBufferSize = 64 * 1024;
+        constexpr std::size_t k_buddyAllocatorMinBlockSize = 16;
+        constexpr std::size_t k_defaultBlockSize = 32 * 1024;
+        constexpr std::size_t k_defaultPageSize = 2;
+
+        /// @param node
+        ///     The node id to look for.
+        ///
+        /// @return Whether or not the given node id is one of the nodes reported by the system. Node ids are not
+        /// necessarily contiguous, so this cannot be inferred from the number of nodes.
+        ///
+        bool IsNode(std::uint32_t node)
+        {
+            auto nodes = IC::Numa::GetNodes();
+            return std::find(nodes.begin(), nodes.end(), node) != nodes.end();
+        }
+    }
+
+    /// A series of unit tests for NUMA aware allocator placement. Node 0 exists on every machine, including those without NUMA support, so these tests pass on single node machines.
+    ///
+    TEST_CASE("Numa", "[Allocator]")
+    {
+        /// Confirms that at least one node is always reported.
+        ///
+        SECTION("NumNodes")
+        {
+            REQUIRE(IC::Numa::GetNumNodes() >= 1);
+            REQUIRE(IC::Numa::GetNodes().size() == IC::Numa::GetNumNodes());
+        }
+
+        /// Confirms that the node of the calling thread is always a valid node.
+        ///
+        SECTION("CurrentNode")
+        {
+            REQUIRE(IsNode(IC::Numa::GetCurrentNode()));
+        }
+
+        /// Confirms that a Buddy Allocator can be bound to a node.
+        ///
+        SECTION("BuddyAllocator")
+        {
+            constexpr std::uint32_t k_node = 0;
+
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize, IC::NumaNode(k_node));
+
+            auto valueA = IC::MakeUnique<int>(allocator, 1);
+            auto valueB = IC::MakeUnique<int>(allocator, 2);
+
+            REQUIRE(*valueA == 1);
+            REQUIRE(*valueB == 2);
+            REQUIRE(allocator.GetNumaNode() == k_node);
+        }
+
+        /// Confirms that a Paged Block Allocator can be bound to a node, and that pages acquired after construction are also valid.
+        ///
+        SECTION("PagedBlockAllocator")
+        {
+            constexpr std::uint32_t k_node = 0;
+
+            IC::PagedBlockAllocator pagedBlockAllocator(k_defaultBlockSize, k_defaultPageSize, IC::NumaNode(k_node));
+
+            auto valueA = IC::MakeUnique<int>(pagedBlockAllocator, 1);
+            auto valueB = IC::MakeUnique<int>(pagedBlockAllocator, 2);
+            auto valueC = IC::MakeUnique<int>(pagedBlockAllocator, 3);
+
+            REQUIRE(*valueA == 1);
+            REQUIRE(*valueB == 2);
+            REQUIRE(*valueC == 3);
+            REQUIRE(pagedBlockAllocator.GetNumPages() == 2);
+            REQUIRE(pagedBlockAllocator.GetNumaNode() == k_node);
+        }
+
+        /// Confirms that binding to a node which does not exist falls back to the default placement rather than failing.
+        ///
+        SECTION("MissingNode")
+        {
+            auto nodes = IC::Numa::GetNodes();
+            auto missingNode = *std::max_element(nodes.begin(), nodes.end()) + 1;
+
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize, IC::NumaNode(missingNode));
+
+            auto value = IC::MakeUnique<int>(allocator, 1);
+
+            REQUIRE(*value == 1);
+        }
+
+        /// Confirms that a registry holds one allocator per node and returns the one for the node of the calling thread. The
+        /// thread may migrate while the allocator is looked up, so the node either side of the lookup is accepted.
+        ///
+        SECTION("Registry")
+        {
+            IC::NumaAllocatorRegistry<IC::BuddyAllocator> registry(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            REQUIRE(registry.GetNumAllocators() == IC::Numa::GetNumNodes());
+
+            auto nodeBefore = IC::Numa::GetCurrentNode();
+            auto& allocator = registry.Get();
+            auto nodeAfter = IC::Numa::GetCurrentNode();
+
+            auto value = IC::MakeUnique<int>(allocator, 1);
+
+            REQUIRE(*value == 1);
+            REQUIRE((allocator.GetNumaNode() == nodeBefore || allocator.GetNumaNode() == nodeAfter));
+        }
+
+        /// Confirms that the memory handed out by a Buddy Allocator bound to a node is physically placed on that node.
+        /// On single node machines every address is reported as being on node 0.
+        ///
+        SECTION("BuddyAllocatorPlacement")
+        {
+            for (auto node : IC::Numa::GetNodes())
+            {
+                IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize, IC::NumaNode(node));
+
+                auto value = IC::MakeUnique<int>(allocator, 1);
+
+                REQUIRE(IC::Numa::GetNodeOfAddress(value.get()) == node);
+            }
+        }
+
+        /// Confirms that every page of a Paged Block Allocator bound to a node, including those acquired after
+        /// construction, is physically placed on that node. On single node machines every address is reported as being
+        /// on node 0.
+        ///
+        SECTION("PagedBlockAllocatorPlacement")
+        {
+            for (auto node : IC::Numa::GetNodes())
+            {
+                IC::PagedBlockAllocator pagedBlockAllocator(k_defaultBlockSize, k_defaultPageSize, IC::NumaNode(node));
+
+                auto valueA = IC::MakeUnique<int>(pagedBlockAllocator, 1);
+                auto valueB = IC::MakeUnique<int>(pagedBlockAllocator, 2);
+                auto valueC = IC::MakeUnique<int>(pagedBlockAllocator, 3);
+
+                REQUIRE(pagedBlockAllocator.GetNumPages() == 2);
+                REQUIRE(IC::Numa::GetNodeOfAddress(valueA.get()) == node);
+                REQUIRE(IC::Numa::GetNodeOfAddress(valueC.get()) == node);
+            }
+        }
+    }
+}
\ No newline at end of file
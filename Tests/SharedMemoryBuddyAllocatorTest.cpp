@@ -0,0 +1,242 @@
+// Created by Ian Copland on 2026-10-18
+//
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../ICMemory/ICMemory.h"
+
+#include <catch.hpp>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace ICMemoryTest
+{
+    namespace
+    {
+        constexpr char k_segmentNamePrefix[] = "/ICMemoryTestSharedMemory";
+        constexpr std::size_t k_bufferSize = 64 * 1024;
+        constexpr std::size_t k_minBlockSize = 16;
+
+        /// @return The name of the shared memory segment used by this process. The process id is appended so that
+        /// concurrent runs of the tests never attach to each other's segment.
+        ///
+        std::string GetSegmentName()
+        {
+#if defined(_WIN32)
+            return k_segmentNamePrefix + std::to_string(GetCurrentProcessId());
+#else
+            return k_segmentNamePrefix + std::to_string(getpid());
+#endif
+        }
+
+        /// Removes the named shared memory segment both on construction, in case it was left behind by a previous run
+        /// which did not exit cleanly, and on destruction.
+        ///
+        class ScopedSegmentName final
+        {
+        public:
+            /// @param name
+            ///     The name of the segment.
+            ///
+            ScopedSegmentName(const std::string& name)
+                : m_name(name)
+            {
+                IC::SharedMemoryBuddyAllocator::Remove(m_name.c_str());
+            }
+
+            ~ScopedSegmentName()
+            {
+                IC::SharedMemoryBuddyAllocator::Remove(m_name.c_str());
+            }
+
+            /// @return The name of the segment.
+            ///
+            const char* Get() const { return m_name.c_str(); }
+
+        private:
+            std::string m_name;
+        };
+    }
+
+    /// A series of unit tests for the SharedMemoryBuddyAllocator. A second process is simulated by attaching to the segment a second time, which maps it at a different address.
+    ///
+    TEST_CASE("SharedMemoryBuddyAllocator", "[Allocator]")
+    {
+        /// Confirms that objects can be allocated and deallocated from a SharedMemoryBuddyAllocator.
+        ///
+        SECTION("Allocate")
+        {
+            ScopedSegmentName segmentName(GetSegmentName());
+            IC::SharedMemoryBuddyAllocator allocator(segmentName.Get(), k_bufferSize, k_minBlockSize);
+
+            auto valueA = IC::MakeUnique<int>(allocator, 1);
+            auto valueB = IC::MakeUnique<int>(allocator, 2);
+            valueB.reset();
+            auto valueC = IC::MakeUnique<int>(allocator, 3);
+            valueB = IC::MakeUnique<int>(allocator, 4);
+
+            REQUIRE(*valueA == 1);
+            REQUIRE(*valueB == 4);
+            REQUIRE(*valueC == 3);
+        }
+
+        /// Confirms that memory allocated through one attachment can be read and deallocated through another, using offsets into the segment as handles.
+        ///
+        SECTION("Attach")
+        {
+            ScopedSegmentName segmentName(GetSegmentName());
+            IC::SharedMemoryBuddyAllocator owner(segmentName.Get(), k_bufferSize, k_minBlockSize);
+            IC::SharedMemoryBuddyAllocator attached(segmentName.Get());
+
+            auto memory = static_cast<int*>(owner.Allocate(sizeof(int)));
+            *memory = 1;
+
+            auto offset = owner.GetOffset(memory);
+            auto attachedMemory = static_cast<int*>(attached.GetPointer(offset));
+
+            REQUIRE(*attachedMemory == 1);
+
+            *attachedMemory = 2;
+            REQUIRE(*memory == 2);
+
+            attached.Deallocate(attachedMemory);
+        }
+
+        /// Confirms that offset pointers stored inside the segment remain valid through another attachment.
+        ///
+        SECTION("OffsetPtr")
+        {
+            struct ExampleMessage
+            {
+                IC::OffsetPtr<char> m_payload;
+                std::size_t m_size;
+            };
+
+            constexpr char k_payload[] = "test";
+
+            ScopedSegmentName segmentName(GetSegmentName());
+            IC::SharedMemoryBuddyAllocator owner(segmentName.Get(), k_bufferSize, k_minBlockSize);
+            IC::SharedMemoryBuddyAllocator attached(segmentName.Get());
+
+            auto message = static_cast<ExampleMessage*>(owner.Allocate(sizeof(ExampleMessage)));
+            auto payload = static_cast<char*>(owner.Allocate(sizeof(k_payload)));
+            std::memcpy(payload, k_payload, sizeof(k_payload));
+            message->m_payload = payload;
+            message->m_size = sizeof(k_payload);
+
+            auto attachedMessage = static_cast<ExampleMessage*>(attached.GetPointer(owner.GetOffset(message)));
+
+            REQUIRE(attachedMessage != message);
+            REQUIRE(attachedMessage->m_size == sizeof(k_payload));
+            REQUIRE(std::strcmp(attachedMessage->m_payload.get(), k_payload) == 0);
+        }
+
+        /// Confirms that allocations made concurrently through separate attachments never overlap.
+        ///
+        SECTION("Concurrent")
+        {
+            constexpr int k_numThreads = 4;
+            constexpr int k_numAllocations = 1000;
+
+            ScopedSegmentName segmentName(GetSegmentName());
+            IC::SharedMemoryBuddyAllocator owner(segmentName.Get(), k_bufferSize, k_minBlockSize);
+
+            std::vector<int> results(k_numThreads, 0);
+            std::vector<std::thread> threads;
+            for (auto i = 0; i < k_numThreads; ++i)
+            {
+                threads.emplace_back([&results, &segmentName, i]()
+                {
+                    IC::SharedMemoryBuddyAllocator attached(segmentName.Get());
+
+                    for (auto j = 0; j < k_numAllocations; ++j)
+                    {
+                        auto memory = static_cast<int*>(attached.Allocate(sizeof(int)));
+                        *memory = i;
+                        std::this_thread::yield();
+                        results[i] += (*memory == i) ? 1 : 0;
+                        attached.Deallocate(memory);
+                    }
+                });
+            }
+
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            for (auto result : results)
+            {
+                REQUIRE(result == k_numAllocations);
+            }
+        }
+
+        /// Confirms that the allocator recovers when the holder of the segment's lock dies without releasing it. The
+        /// death of another process is simulated by a thread which attaches to the segment, takes the lock and then
+        /// exits while still holding it.
+        ///
+        SECTION("LockHolderDeath")
+        {
+            ScopedSegmentName segmentName(GetSegmentName());
+            IC::SharedMemoryBuddyAllocator owner(segmentName.Get(), k_bufferSize, k_minBlockSize);
+
+            auto memoryA = static_cast<int*>(owner.Allocate(sizeof(int)));
+            REQUIRE(memoryA != nullptr);
+            *memoryA = 1;
+
+            std::thread lockHolder([&segmentName]()
+            {
+                IC::SharedMemoryBuddyAllocator attached(segmentName.Get());
+                attached.Lock();
+            });
+            lockHolder.join();
+
+            REQUIRE(owner.GetNumRecoveries() == 0);
+
+            auto memoryB = static_cast<int*>(owner.Allocate(sizeof(int)));
+
+            REQUIRE(owner.GetNumRecoveries() == 1);
+            REQUIRE(memoryB != nullptr);
+            REQUIRE(memoryB != memoryA);
+
+            *memoryB = 2;
+            REQUIRE(*memoryA == 1);
+            REQUIRE(*memoryB == 2);
+
+            owner.Deallocate(memoryB);
+            owner.Deallocate(memoryA);
+
+            auto memoryC = owner.Allocate(sizeof(int));
+            REQUIRE(memoryC != nullptr);
+            REQUIRE(owner.GetNumRecoveries() == 1);
+            owner.Deallocate(memoryC);
+        }
+    }
+}
\ No newline at end of file
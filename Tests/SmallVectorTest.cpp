@@ -0,0 +1,206 @@
+// Created by Ian Copland on 2026-10-18
+//
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../ICMemory/ICMemory.h"
+
+#include <catch.hpp>
+#include <vector>
+
+namespace ICMemoryTest
+{
+    namespace
+    {
+        constexpr std::size_t k_linearAllocatorBufferSize = 4 * 1024;
+        constexpr std::size_t k_buddyAllocatorBufferSize = 2048;
+        constexpr std::size_t k_buddyAllocatorMinBlockSize = 16;
+        constexpr std::size_t k_inlineCapacity = 4;
+    }
+
+    /// A series of unit tests for small vectors which spill into the memory pools.
+    ///
+    TEST_CASE("SmallVector", "[Container]")
+    {
+        /// Confirms that an empty vector can be allocated from the Buddy Allocator.
+        ///
+        SECTION("MakeEmptyBuddyAllocator")
+        {
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            auto vec = IC::MakeSmallVector<int, k_inlineCapacity>(allocator);
+            vec.push_back(5);
+            vec.push_back(6);
+
+            REQUIRE(vec.size() == 2);
+            REQUIRE(vec[0] == 5);
+            REQUIRE(vec[1] == 6);
+        }
+
+        /// Confirms that an empty vector can be allocated from the Linear Allocator.
+        ///
+        SECTION("MakeEmptyLinearAllocator")
+        {
+            IC::LinearAllocator linearAllocator(k_linearAllocatorBufferSize);
+
+            auto vec = IC::MakeSmallVector<int, k_inlineCapacity>(linearAllocator);
+            vec.push_back(5);
+            vec.push_back(6);
+
+            REQUIRE(vec.size() == 2);
+            REQUIRE(vec[0] == 5);
+            REQUIRE(vec[1] == 6);
+        }
+
+        /// Confirms that a vector can be allocated from the Buddy Allocator with a range.
+        ///
+        SECTION("MakeRangeBuddyAllocator")
+        {
+            const std::vector<int> toCopy = { 5, 6 };
+
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            auto vec = IC::MakeSmallVector<int, k_inlineCapacity>(allocator, toCopy.begin(), toCopy.end());
+
+            REQUIRE(vec.size() == 2);
+            REQUIRE(vec[0] == 5);
+            REQUIRE(vec[1] == 6);
+        }
+
+        /// Confirms that a vector can be allocated from the Linear Allocator with a range.
+        ///
+        SECTION("MakeRangeLinearAllocator")
+        {
+            const std::vector<int> toCopy = { 5, 6 };
+
+            IC::LinearAllocator linearAllocator(k_linearAllocatorBufferSize);
+
+            auto vec = IC::MakeSmallVector<int, k_inlineCapacity>(linearAllocator, toCopy.begin(), toCopy.end());
+
+            REQUIRE(vec.size() == 2);
+            REQUIRE(vec[0] == 5);
+            REQUIRE(vec[1] == 6);
+        }
+
+        /// Confirms that a vector can be allocated from the Buddy Allocator using a std::vector.
+        ///
+        SECTION("MakeStdVectorBuddyAllocator")
+        {
+            const std::vector<int> toCopy = { 5, 6 };
+
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            auto vec = IC::MakeSmallVector<int, k_inlineCapacity>(allocator, toCopy);
+
+            REQUIRE(vec.size() == 2);
+            REQUIRE(vec[0] == 5);
+            REQUIRE(vec[1] == 6);
+        }
+
+        /// Confirms that a vector can be allocated from the Linear Allocator using a std::vector.
+        ///
+        SECTION("MakeStdVectorLinearAllocator")
+        {
+            const std::vector<int> toCopy = { 5, 6 };
+
+            IC::LinearAllocator linearAllocator(k_linearAllocatorBufferSize);
+
+            auto vec = IC::MakeSmallVector<int, k_inlineCapacity>(linearAllocator, toCopy);
+
+            REQUIRE(vec.size() == 2);
+            REQUIRE(vec[0] == 5);
+            REQUIRE(vec[1] == 6);
+        }
+
+        /// Confirms that a small vector stores its elements inline, without touching the allocator, while it holds no
+        /// more than its inline capacity.
+        ///
+        SECTION("Inline")
+        {
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            auto vec = IC::MakeSmallVector<int, k_inlineCapacity>(allocator);
+            for (std::size_t i = 0; i < k_inlineCapacity; ++i)
+            {
+                vec.push_back(static_cast<int>(i));
+            }
+
+            auto vecBegin = reinterpret_cast<const char*>(&vec);
+            auto vecEnd = vecBegin + sizeof(vec);
+            auto data = reinterpret_cast<const char*>(vec.data());
+
+            REQUIRE(vec.size() == k_inlineCapacity);
+            REQUIRE(data >= vecBegin);
+            REQUIRE(data < vecEnd);
+            REQUIRE(allocator.GetAllocatedBytes() == 0);
+        }
+
+        /// Confirms that a small vector spills into memory taken from the allocator once it grows past its inline capacity.
+        ///
+        SECTION("Spill")
+        {
+            constexpr std::size_t k_numValues = k_inlineCapacity * 4;
+
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            auto vec = IC::MakeSmallVector<int, k_inlineCapacity>(allocator);
+            for (std::size_t i = 0; i < k_numValues; ++i)
+            {
+                vec.push_back(static_cast<int>(i));
+            }
+
+            auto vecBegin = reinterpret_cast<const char*>(&vec);
+            auto vecEnd = vecBegin + sizeof(vec);
+            auto data = reinterpret_cast<const char*>(vec.data());
+
+            REQUIRE(vec.size() == k_numValues);
+            REQUIRE((data < vecBegin || data >= vecEnd));
+            REQUIRE(allocator.GetAllocatedBytes() >= k_numValues * sizeof(int));
+            for (std::size_t i = 0; i < k_numValues; ++i)
+            {
+                REQUIRE(vec[i] == static_cast<int>(i));
+            }
+        }
+
+        /// Confirms that a small vector which has spilled into the allocator can be moved without copying its elements.
+        ///
+        SECTION("MoveSpilled")
+        {
+            constexpr std::size_t k_numValues = k_inlineCapacity * 2;
+
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            auto vecA = IC::MakeSmallVector<int, k_inlineCapacity>(allocator);
+            for (std::size_t i = 0; i < k_numValues; ++i)
+            {
+                vecA.push_back(static_cast<int>(i));
+            }
+            auto data = vecA.data();
+
+            auto vecB = std::move(vecA);
+
+            REQUIRE(vecB.size() == k_numValues);
+            REQUIRE(vecB.data() == data);
+            REQUIRE(vecB[k_numValues - 1] == static_cast<int>(k_numValues - 1));
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,148 @@
+// Created by Ian Copland on 2026-10-18
+//
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../ICMemory/ICMemory.h"
+
+#include <catch.hpp>
+#include <thread>
+
+namespace ICMemoryTest
+{
+    namespace
+    {
+        constexpr std::size_t k_linearAllocatorBufferSize = 4 * 1024;
+        constexpr std::size_t k_buddyAllocatorBufferSize = 2048;
+        constexpr std::size_t k_buddyAllocatorMinBlockSize = 16;
+        constexpr std::size_t k_queueCapacity = 8;
+    }
+
+    /// A series of unit tests for single producer, single consumer ring queues allocated from the memory pools.
+    ///
+    TEST_CASE("SpscRingQueue", "[Container]")
+    {
+        /// Confirms that an empty queue can be allocated from the Buddy Allocator.
+        ///
+        SECTION("MakeEmptyBuddyAllocator")
+        {
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            auto queue = IC::MakeSpscRingQueue<int>(allocator, k_queueCapacity);
+            REQUIRE(queue.TryPush(5));
+            REQUIRE(queue.TryPush(6));
+
+            int value = 0;
+            REQUIRE(queue.TryPop(value));
+            REQUIRE(value == 5);
+            REQUIRE(queue.TryPop(value));
+            REQUIRE(value == 6);
+            REQUIRE(!queue.TryPop(value));
+        }
+
+        /// Confirms that an empty queue can be allocated from the Linear Allocator.
+        ///
+        SECTION("MakeEmptyLinearAllocator")
+        {
+            IC::LinearAllocator linearAllocator(k_linearAllocatorBufferSize);
+
+            auto queue = IC::MakeSpscRingQueue<int>(linearAllocator, k_queueCapacity);
+            REQUIRE(queue.TryPush(5));
+            REQUIRE(queue.TryPush(6));
+
+            int value = 0;
+            REQUIRE(queue.TryPop(value));
+            REQUIRE(value == 5);
+            REQUIRE(queue.TryPop(value));
+            REQUIRE(value == 6);
+            REQUIRE(!queue.TryPop(value));
+        }
+
+        /// Confirms that the requested capacity is rounded up to a power of two.
+        ///
+        SECTION("Capacity")
+        {
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            auto queue = IC::MakeSpscRingQueue<int>(allocator, 5);
+
+            REQUIRE(queue.GetCapacity() == 8);
+        }
+
+        /// Confirms that pushing to a full queue fails without overwriting the queued values.
+        ///
+        SECTION("Full")
+        {
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            auto queue = IC::MakeSpscRingQueue<int>(allocator, k_queueCapacity);
+            for (std::size_t i = 0; i < k_queueCapacity; ++i)
+            {
+                REQUIRE(queue.TryPush(static_cast<int>(i)));
+            }
+
+            REQUIRE(!queue.TryPush(-1));
+
+            int value = -1;
+            REQUIRE(queue.TryPop(value));
+            REQUIRE(value == 0);
+        }
+
+        /// Confirms that values are received in order when the producer and consumer run on different threads.
+        ///
+        SECTION("Threaded")
+        {
+            constexpr int k_numValues = 100000;
+
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            auto queue = IC::MakeSpscRingQueue<int>(allocator, k_queueCapacity);
+
+            std::thread producer([&queue]()
+            {
+                for (auto i = 0; i < k_numValues; ++i)
+                {
+                    while (!queue.TryPush(i))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+
+            auto inOrder = true;
+            for (auto i = 0; i < k_numValues; ++i)
+            {
+                int value = -1;
+                while (!queue.TryPop(value))
+                {
+                    std::this_thread::yield();
+                }
+
+                inOrder = inOrder && (value == i);
+            }
+
+            producer.join();
+
+            REQUIRE(inOrder);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,145 @@
+// Created by Ian Copland on 2026-10-18
+//
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../ICMemory/ICMemory.h"
+
+#include <catch.hpp>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ICMemoryTest
+{
+    namespace
+    {
+        constexpr std::size_t k_linearAllocatorBufferSize = 4 * 1024;
+        constexpr std::size_t k_buddyAllocatorBufferSize = 2048;
+        constexpr std::size_t k_buddyAllocatorMinBlockSize = 16;
+    }
+
+    /// A series of unit tests for the statically typed allocator wrapper.
+    ///
+    TEST_CASE("StaticAllocatorWrapper", "[Allocator]")
+    {
+        /// Confirms that a vector made from a concrete Linear Allocator uses the statically typed wrapper.
+        ///
+        SECTION("MakeVectorLinearAllocator")
+        {
+            IC::LinearAllocator linearAllocator(k_linearAllocatorBufferSize);
+
+            auto vec = IC::MakeVector<int>(linearAllocator);
+            vec.push_back(5);
+            vec.push_back(6);
+
+            using AllocatorType = decltype(vec.get_allocator());
+            REQUIRE((std::is_same<AllocatorType, IC::StaticAllocatorWrapper<IC::LinearAllocator, int>>::value));
+            REQUIRE(vec.size() == 2);
+            REQUIRE(vec[0] == 5);
+            REQUIRE(vec[1] == 6);
+        }
+
+        /// Confirms that a vector made from a concrete Buddy Allocator uses the statically typed wrapper.
+        ///
+        SECTION("MakeVectorBuddyAllocator")
+        {
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            auto vec = IC::MakeVector<int>(allocator);
+            vec.push_back(5);
+            vec.push_back(6);
+
+            using AllocatorType = decltype(vec.get_allocator());
+            REQUIRE((std::is_same<AllocatorType, IC::StaticAllocatorWrapper<IC::BuddyAllocator, int>>::value));
+            REQUIRE(vec.size() == 2);
+            REQUIRE(vec[0] == 5);
+            REQUIRE(vec[1] == 6);
+        }
+
+        /// Confirms that a vector made through an IAllocator reference still uses the virtual allocator wrapper.
+        ///
+        SECTION("MakeVectorIAllocator")
+        {
+            IC::LinearAllocator linearAllocator(k_linearAllocatorBufferSize);
+            IC::IAllocator& allocator = linearAllocator;
+
+            auto vec = IC::MakeVector<int>(allocator);
+            vec.push_back(5);
+            vec.push_back(6);
+
+            using AllocatorType = decltype(vec.get_allocator());
+            REQUIRE((std::is_same<AllocatorType, IC::AllocatorWrapper<int>>::value));
+            REQUIRE(vec.size() == 2);
+            REQUIRE(vec[0] == 5);
+            REQUIRE(vec[1] == 6);
+        }
+
+        /// Confirms that an unordered map made from a concrete allocator rebinds the statically typed wrapper to its nodes.
+        ///
+        SECTION("MakeUnorderedMapLinearAllocator")
+        {
+            IC::LinearAllocator linearAllocator(k_linearAllocatorBufferSize);
+
+            auto map = IC::MakeUnorderedMap<std::string, int>(linearAllocator);
+            map.emplace("5", 5);
+            map.emplace("6", 6);
+
+            using AllocatorType = decltype(map.get_allocator());
+            REQUIRE((std::is_same<AllocatorType, IC::StaticAllocatorWrapper<IC::LinearAllocator, std::pair<const std::string, int>>>::value));
+            REQUIRE(map.size() == 2);
+            REQUIRE(map["5"] == 5);
+            REQUIRE(map["6"] == 6);
+        }
+
+        /// Confirms that statically typed wrappers compare equal only when they wrap the same allocator, including after rebinding.
+        ///
+        SECTION("Equality")
+        {
+            IC::LinearAllocator linearAllocatorA(k_linearAllocatorBufferSize);
+            IC::LinearAllocator linearAllocatorB(k_linearAllocatorBufferSize);
+
+            IC::StaticAllocatorWrapper<IC::LinearAllocator, int> wrapperA(linearAllocatorA);
+            IC::StaticAllocatorWrapper<IC::LinearAllocator, char> wrapperA2(wrapperA);
+            IC::StaticAllocatorWrapper<IC::LinearAllocator, int> wrapperB(linearAllocatorB);
+
+            REQUIRE(wrapperA == wrapperA2);
+            REQUIRE(wrapperA != wrapperB);
+        }
+
+        /// Confirms that a statically typed wrapper can be used directly with a standard container.
+        ///
+        SECTION("StdVector")
+        {
+            IC::LinearAllocator linearAllocator(k_linearAllocatorBufferSize);
+
+            std::vector<int, IC::StaticAllocatorWrapper<IC::LinearAllocator, int>> vec(linearAllocator);
+            vec.push_back(5);
+            vec.push_back(6);
+
+            REQUIRE(vec.size() == 2);
+            REQUIRE(vec[0] == 5);
+            REQUIRE(vec[1] == 6);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,175 @@
+// Created by Ian Copland on 2026-10-18
+//
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../ICMemory/ICMemory.h"
+
+#include <catch.hpp>
+#include <string>
+
+namespace ICMemoryTest
+{
+    namespace
+    {
+        constexpr std::size_t k_linearAllocatorBufferSize = 4 * 1024;
+        constexpr std::size_t k_buddyAllocatorBufferSize = 2048;
+        constexpr std::size_t k_buddyAllocatorMinBlockSize = 16;
+        constexpr std::size_t k_pageSize = 16;
+
+        /// Concatenates the chunks of the given string builder into a std::string.
+        ///
+        /// @param stringBuilder
+        ///     The string builder to read the chunks from.
+        ///
+        /// @return The concatenated string.
+        ///
+        std::string ConcatenateChunks(const IC::StringBuilder& stringBuilder)
+        {
+            std::string output;
+            for (const auto& chunk : stringBuilder.GetChunks())
+            {
+                output.append(reinterpret_cast<const char*>(chunk.m_data), chunk.m_size);
+            }
+
+            return output;
+        }
+    }
+
+    /// A series of unit tests for the StringBuilder.
+    ///
+    TEST_CASE("StringBuilder", "[Container]")
+    {
+        /// Confirms that appended strings can be flattened into a single string.
+        ///
+        SECTION("ToString")
+        {
+            IC::LinearAllocator linearAllocator(k_linearAllocatorBufferSize);
+            IC::StringBuilder stringBuilder;
+
+            stringBuilder.Append("test");
+            stringBuilder.Append(std::string("String"));
+            stringBuilder.Append('!');
+
+            auto string = stringBuilder.ToString(linearAllocator);
+
+            REQUIRE(string == "testString!");
+            REQUIRE(stringBuilder.GetSize() == string.size());
+        }
+
+        /// Confirms that the chunks of a string builder describe the appended strings in order.
+        ///
+        SECTION("Chunks")
+        {
+            IC::StringBuilder stringBuilder(k_pageSize);
+
+            stringBuilder.Append("test");
+            stringBuilder.Append("String");
+
+            REQUIRE(ConcatenateChunks(stringBuilder) == "testString");
+        }
+
+        /// Confirms that appending beyond the page size spreads the string over multiple chunks, none of which are larger than a page.
+        ///
+        SECTION("Paging")
+        {
+            constexpr int k_numAppends = 20;
+
+            IC::StringBuilder stringBuilder(k_pageSize);
+
+            std::string expected;
+            for (auto i = 0; i < k_numAppends; ++i)
+            {
+                stringBuilder.Append("test");
+                expected.append("test");
+            }
+
+            REQUIRE(stringBuilder.GetChunks().size() > 1);
+            for (const auto& chunk : stringBuilder.GetChunks())
+            {
+                REQUIRE(chunk.m_size <= k_pageSize);
+            }
+
+            REQUIRE(ConcatenateChunks(stringBuilder) == expected);
+        }
+
+        /// Confirms that previously appended data is never moved by later appends.
+        ///
+        SECTION("NoReallocation")
+        {
+            constexpr int k_numAppends = 20;
+
+            IC::StringBuilder stringBuilder(k_pageSize);
+            stringBuilder.Append("test");
+
+            auto firstChunkData = stringBuilder.GetChunks().front().m_data;
+
+            for (auto i = 0; i < k_numAppends; ++i)
+            {
+                stringBuilder.Append("test");
+            }
+
+            REQUIRE(stringBuilder.GetChunks().front().m_data == firstChunkData);
+        }
+
+        /// Confirms that a single string larger than the page size can be appended.
+        ///
+        SECTION("LargeAppend")
+        {
+            const std::string k_largeString = "GVFuEQyRi*wIn#LAVl@5LWTLqKitenElz#EKiSMf#DW!wsa5Ev#xLxs(LH&IZku";
+
+            IC::StringBuilder stringBuilder(k_pageSize);
+            stringBuilder.Append(k_largeString);
+
+            REQUIRE(stringBuilder.GetSize() == k_largeString.size());
+            REQUIRE(ConcatenateChunks(stringBuilder) == k_largeString);
+        }
+
+        /// Confirms that clearing a string builder discards its contents.
+        ///
+        SECTION("Clear")
+        {
+            IC::StringBuilder stringBuilder(k_pageSize);
+            stringBuilder.Append("test");
+            stringBuilder.Clear();
+            stringBuilder.Append("String");
+
+            REQUIRE(stringBuilder.GetSize() == 6);
+            REQUIRE(ConcatenateChunks(stringBuilder) == "String");
+        }
+
+        /// Confirms that a StringBuilder can be backed by a Buddy Allocator.
+        ///
+        SECTION("BuddyAllocatorBacked")
+        {
+            IC::BuddyAllocator buddyAllocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+            IC::StringBuilder stringBuilder(buddyAllocator, k_pageSize);
+
+            stringBuilder.Append("test");
+            stringBuilder.Append("String");
+
+            auto string = stringBuilder.ToString(buddyAllocator);
+
+            REQUIRE(string == "testString");
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,172 @@
+// Created by Ian Copland on 2026-10-18
+//
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../ICMemory/ICMemory.h"
+
+#include <catch.hpp>
+
+namespace ICMemoryTest
+{
+    namespace
+    {
+        constexpr std::size_t k_linearAllocatorBufferSize = 4 * 1024;
+        constexpr std::size_t k_buddyAllocatorBufferSize = 2048;
+        constexpr std::size_t k_buddyAllocatorMinBlockSize = 16;
+    }
+
+    /// A series of unit tests for weak pointers to objects allocated from the memory pools.
+    ///
+    TEST_CASE("WeakPtr", "[Container]")
+    {
+        /// Confirms that a weak pointer to an object allocated from a Buddy Allocator can be locked.
+        ///
+        SECTION("LockBuddyAllocator")
+        {
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            auto allocated = IC::MakeShared<int>(allocator, 1);
+            IC::WeakPtr<int> weak = allocated;
+
+            auto locked = weak.lock();
+
+            REQUIRE(locked == allocated);
+            REQUIRE(*locked == 1);
+        }
+
+        /// Confirms that a weak pointer to an object allocated from a Linear Allocator can be locked.
+        ///
+        SECTION("LockLinearAllocator")
+        {
+            IC::LinearAllocator linearAllocator(k_linearAllocatorBufferSize);
+
+            auto allocated = IC::MakeShared<int>(linearAllocator, 1);
+            IC::WeakPtr<int> weak = allocated;
+
+            auto locked = weak.lock();
+
+            REQUIRE(locked == allocated);
+            REQUIRE(*locked == 1);
+        }
+
+        /// Confirms that a weak pointer to an object allocated from an Object Pool can be locked.
+        ///
+        SECTION("LockObjectPool")
+        {
+            constexpr std::size_t k_poolSize = 8;
+
+            IC::ObjectPool<int> objectPool(k_poolSize);
+
+            IC::SharedPtr<int> allocated = objectPool.Create(1);
+            IC::WeakPtr<int> weak = allocated;
+
+            auto locked = weak.lock();
+
+            REQUIRE(locked == allocated);
+            REQUIRE(*locked == 1);
+        }
+
+        /// Confirms that a weak pointer to an object allocated from a Paged Object Pool can be locked.
+        ///
+        SECTION("LockPagedObjectPool")
+        {
+            IC::PagedObjectPool<int> pagedObjectPool;
+
+            IC::SharedPtr<int> allocated = pagedObjectPool.Create(1);
+            IC::WeakPtr<int> weak = allocated;
+
+            auto locked = weak.lock();
+
+            REQUIRE(locked == allocated);
+            REQUIRE(*locked == 1);
+        }
+
+        /// Confirms that locking a weak pointer fails once the last shared pointer has been released.
+        ///
+        SECTION("Expired")
+        {
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            auto allocated = IC::MakeShared<int>(allocator, 1);
+            IC::WeakPtr<int> weak = allocated;
+
+            REQUIRE(!weak.expired());
+
+            allocated.reset();
+
+            REQUIRE(weak.expired());
+            REQUIRE(weak.lock() == nullptr);
+        }
+
+        /// Confirms that the object is destroyed when the last shared pointer is released, even though weak pointers remain.
+        ///
+        SECTION("EarlyDestruction")
+        {
+            struct ExampleClass
+            {
+                ExampleClass(bool& destroyed) : m_destroyed(destroyed) {}
+                ~ExampleClass() { m_destroyed = true; }
+                bool& m_destroyed;
+            };
+
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            bool destroyed = false;
+            auto allocated = IC::MakeShared<ExampleClass>(allocator, destroyed);
+            IC::WeakPtr<ExampleClass> weak = allocated;
+
+            allocated.reset();
+
+            REQUIRE(destroyed);
+        }
+
+        /// Confirms that an Object Pool slot is not returned when the last shared pointer is released while a weak pointer
+        /// remains, and is returned once the last weak pointer has also been released. The pool only has a single slot, so
+        /// the second object could not be created otherwise.
+        ///
+        SECTION("ObjectPoolSlotReturned")
+        {
+            constexpr std::size_t k_poolSize = 1;
+
+            IC::ObjectPool<int> objectPool(k_poolSize);
+
+            {
+                IC::SharedPtr<int> allocated = objectPool.Create(1);
+                IC::WeakPtr<int> weak = allocated;
+
+                REQUIRE(objectPool.GetNumFreeSlots() == 0);
+
+                allocated.reset();
+
+                REQUIRE(weak.expired());
+                REQUIRE(objectPool.GetNumFreeSlots() == 0);
+            }
+
+            REQUIRE(objectPool.GetNumFreeSlots() == 1);
+
+            IC::SharedPtr<int> allocated = objectPool.Create(2);
+
+            REQUIRE(*allocated == 2);
+        }
+    }
+}
\ No newline at end of file
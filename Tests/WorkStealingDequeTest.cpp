@@ -0,0 +1,267 @@
+// Created by Ian Copland on 2026-10-18
+//
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../ICMemory/ICMemory.h"
+
+#include <catch.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace ICMemoryTest
+{
+    namespace
+    {
+        constexpr std::size_t k_linearAllocatorBufferSize = 4 * 1024;
+        constexpr std::size_t k_buddyAllocatorBufferSize = 16 * 1024;
+        constexpr std::size_t k_buddyAllocatorMinBlockSize = 16;
+        constexpr std::size_t k_initialCapacity = 8;
+    }
+
+    /// A series of unit tests for work stealing deques allocated from the memory pools.
+    ///
+    TEST_CASE("WorkStealingDeque", "[Container]")
+    {
+        /// Confirms that a work stealing deque can be allocated from the Buddy Allocator.
+        ///
+        SECTION("BuddyAllocator")
+        {
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+            IC::WorkStealingDeque<int> deque(allocator, k_initialCapacity);
+
+            deque.Push(5);
+            deque.Push(6);
+
+            REQUIRE(deque.GetSize() == 2);
+        }
+
+        /// Confirms that a work stealing deque can be allocated from the Linear Allocator.
+        ///
+        SECTION("LinearAllocator")
+        {
+            IC::LinearAllocator linearAllocator(k_linearAllocatorBufferSize);
+            IC::WorkStealingDeque<int> deque(linearAllocator, k_initialCapacity);
+
+            deque.Push(5);
+            deque.Push(6);
+
+            REQUIRE(deque.GetSize() == 2);
+        }
+
+        /// Confirms that the owning thread pops values in last in, first out order.
+        ///
+        SECTION("Pop")
+        {
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+            IC::WorkStealingDeque<int> deque(allocator, k_initialCapacity);
+
+            deque.Push(5);
+            deque.Push(6);
+
+            int value = 0;
+            REQUIRE(deque.TryPop(value));
+            REQUIRE(value == 6);
+            REQUIRE(deque.TryPop(value));
+            REQUIRE(value == 5);
+            REQUIRE(!deque.TryPop(value));
+        }
+
+        /// Confirms that other threads steal values in first in, first out order.
+        ///
+        SECTION("Steal")
+        {
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+            IC::WorkStealingDeque<int> deque(allocator, k_initialCapacity);
+
+            deque.Push(5);
+            deque.Push(6);
+
+            int value = 0;
+            REQUIRE(deque.TrySteal(value));
+            REQUIRE(value == 5);
+            REQUIRE(deque.TrySteal(value));
+            REQUIRE(value == 6);
+            REQUIRE(!deque.TrySteal(value));
+        }
+
+        /// Confirms that a work stealing deque grows beyond its initial capacity without losing values.
+        ///
+        SECTION("Growth")
+        {
+            constexpr int k_numValues = 100;
+
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+            IC::WorkStealingDeque<int> deque(allocator, k_initialCapacity);
+
+            for (auto i = 0; i < k_numValues; ++i)
+            {
+                deque.Push(i);
+            }
+
+            REQUIRE(deque.GetSize() == k_numValues);
+            for (auto i = k_numValues - 1; i >= 0; --i)
+            {
+                int value = -1;
+                REQUIRE(deque.TryPop(value));
+                REQUIRE(value == i);
+            }
+        }
+
+        /// Confirms that the arrays retired by growth are reclaimed once no thief can still be reading them.
+        ///
+        SECTION("RetiredArrays")
+        {
+            constexpr int k_numValues = 100;
+
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+            IC::WorkStealingDeque<int> deque(allocator, k_initialCapacity);
+
+            for (auto i = 0; i < k_numValues; ++i)
+            {
+                deque.Push(i);
+            }
+
+            REQUIRE(deque.GetNumRetiredArrays() > 0);
+
+            deque.Reclaim();
+
+            REQUIRE(deque.GetNumRetiredArrays() == 0);
+        }
+
+        /// Confirms that repeatedly growing and draining work stealing deques never exhausts a small allocator, which
+        /// would happen within a few cycles if retired arrays were leaked rather than reclaimed.
+        ///
+        SECTION("GrowDrainCycles")
+        {
+            constexpr std::size_t k_smallBuddyAllocatorBufferSize = 4 * 1024;
+            constexpr int k_numCycles = 100;
+            constexpr int k_numValues = 100;
+
+            IC::BuddyAllocator allocator(k_smallBuddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            for (auto i = 0; i < k_numCycles; ++i)
+            {
+                IC::WorkStealingDeque<int> deque(allocator, k_initialCapacity);
+
+                for (auto j = 0; j < k_numValues; ++j)
+                {
+                    deque.Push(j);
+                }
+
+                int value = -1;
+                for (auto j = 0; j < k_numValues; ++j)
+                {
+                    REQUIRE((j % 2 == 0 ? deque.TryPop(value) : deque.TrySteal(value)));
+                }
+
+                deque.Reclaim();
+
+                REQUIRE(deque.GetNumRetiredArrays() == 0);
+            }
+        }
+
+        /// Confirms that every value is received exactly once when the owner pushes and pops while other threads steal, including while the deque is growing.
+        /// The owner waits for the thieves whenever its backlog reaches k_maxBacklog, so the deque never outgrows the Buddy
+        /// Allocator's buffer regardless of how the threads are scheduled.
+        ///
+        SECTION("Threaded")
+        {
+            constexpr int k_numThieves = 3;
+            constexpr int k_numValues = 100000;
+            constexpr std::size_t k_maxBacklog = 256;
+
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+            IC::WorkStealingDeque<int> deque(allocator, k_initialCapacity);
+
+            std::vector<std::atomic<int>> received(k_numValues);
+            for (auto& count : received)
+            {
+                count = 0;
+            }
+
+            std::atomic<int> numReceived(0);
+
+            std::vector<std::thread> thieves;
+            for (auto i = 0; i < k_numThieves; ++i)
+            {
+                thieves.emplace_back([&deque, &received, &numReceived]()
+                {
+                    while (numReceived < k_numValues)
+                    {
+                        int value = -1;
+                        if (deque.TrySteal(value))
+                        {
+                            ++received[value];
+                            ++numReceived;
+                        }
+                        else
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+                });
+            }
+
+            for (auto i = 0; i < k_numValues; ++i)
+            {
+                while (deque.GetSize() >= k_maxBacklog)
+                {
+                    std::this_thread::yield();
+                }
+
+                deque.Push(i);
+
+                int value = -1;
+                if (i % 2 == 0 && deque.TryPop(value))
+                {
+                    ++received[value];
+                    ++numReceived;
+                }
+            }
+
+            int value = -1;
+            while (deque.TryPop(value))
+            {
+                ++received[value];
+                ++numReceived;
+            }
+
+            for (auto& thief : thieves)
+            {
+                thief.join();
+            }
+
+            deque.Reclaim();
+            REQUIRE(deque.GetNumRetiredArrays() == 0);
+
+            auto receivedOnce = true;
+            for (auto& count : received)
+            {
+                receivedOnce = receivedOnce && (count == 1);
+            }
+
+            REQUIRE(receivedOnce);
+        }
+    }
+}
\ No newline at end of file
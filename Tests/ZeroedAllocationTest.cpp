@@ -0,0 +1,264 @@
+// Created by Ian Copland on 2026-10-18
+//
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../ICMemory/ICMemory.h"
+
+#include <catch.hpp>
+#include <cstring>
+
+namespace ICMemoryTest
+{
+    namespace
+    {
+        constexpr std::size_t k_blockSize = 64;
+        constexpr std::size_t k_numBlocksPerPage = 4;
+        constexpr std::size_t k_pageSize = 256;
+        constexpr std::size_t k_osPagedPageSize = 64 * 1024;
+        constexpr std::size_t k_numBlocksPerOsPagedPage = k_osPagedPageSize / k_blockSize;
+        constexpr int k_numValues = k_blockSize / sizeof(int);
+
+        /// Confirms whether or not every byte in the given range is zero.
+        ///
+        /// @param memory
+        ///     The start of the range.
+        /// @param size
+        ///     The size of the range in bytes.
+        ///
+        /// @return Whether or not the range is zeroed.
+        ///
+        bool IsZeroed(const void* memory, std::size_t size)
+        {
+            auto bytes = static_cast<const std::uint8_t*>(memory);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                if (bytes[i] != 0)
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        /// Allocates a zeroed block from the given allocator, confirms it is zeroed, dirties it and deallocates it. This is repeated so that both freshly acquired and recycled memory is tested.
+        ///
+        /// @param allocator
+        ///     The allocator to test.
+        /// @param size
+        ///     The size of each allocation.
+        ///
+        void TestZeroedAllocations(IC::IAllocator& allocator, std::size_t size)
+        {
+            constexpr int k_numIterations = 4;
+
+            for (auto i = 0; i < k_numIterations; ++i)
+            {
+                auto memory = allocator.AllocateZeroed(size);
+
+                REQUIRE(IsZeroed(memory, size));
+
+                std::memset(memory, 0xFF, size);
+                allocator.Deallocate(memory);
+            }
+        }
+    }
+
+    /// A series of unit tests for zeroed allocations. The paged allocators skip zeroing memory from pages which are known to be untouched since they were acquired from the OS, so these tests confirm that memory which has since been written to is still zeroed correctly.
+    ///
+    TEST_CASE("ZeroedAllocation", "[Allocator]")
+    {
+        /// Confirms that zeroed allocations from a Paged Linear Allocator are zeroed.
+        ///
+        SECTION("PagedLinearAllocator")
+        {
+            IC::PagedLinearAllocator pagedLinearAllocator(k_pageSize);
+
+            TestZeroedAllocations(pagedLinearAllocator, k_blockSize);
+
+            pagedLinearAllocator.Reset();
+
+            TestZeroedAllocations(pagedLinearAllocator, k_blockSize);
+        }
+
+        /// Confirms that a Paged Linear Allocator skips zeroing memory from freshly acquired pages, but zeroes memory from
+        /// pages which have been written to before being reset. Memory is only known to be zero when it comes straight
+        /// from the OS, so the pages are a whole number of OS pages.
+        ///
+        SECTION("PagedLinearAllocatorSkipsFreshPages")
+        {
+            IC::PagedLinearAllocator pagedLinearAllocator(k_osPagedPageSize);
+
+            auto fresh = pagedLinearAllocator.AllocateZeroed(k_blockSize);
+
+            REQUIRE(IsZeroed(fresh, k_blockSize));
+            REQUIRE(pagedLinearAllocator.GetNumZeroFillsSkipped() == 1);
+            REQUIRE(pagedLinearAllocator.GetNumZeroFills() == 0);
+
+            std::memset(fresh, 0xFF, k_blockSize);
+            pagedLinearAllocator.Reset();
+
+            auto dirtied = pagedLinearAllocator.AllocateZeroed(k_blockSize);
+
+            REQUIRE(IsZeroed(dirtied, k_blockSize));
+            REQUIRE(pagedLinearAllocator.GetNumZeroFillsSkipped() == 1);
+            REQUIRE(pagedLinearAllocator.GetNumZeroFills() == 1);
+        }
+
+        /// Confirms that a Paged Linear Allocator whose pages are smaller than an OS page, and so are not acquired
+        /// directly from the OS, always zeroes memory.
+        ///
+        SECTION("PagedLinearAllocatorSubPage")
+        {
+            IC::PagedLinearAllocator pagedLinearAllocator(k_pageSize);
+
+            auto memory = pagedLinearAllocator.AllocateZeroed(k_blockSize);
+
+            REQUIRE(IsZeroed(memory, k_blockSize));
+            REQUIRE(pagedLinearAllocator.GetNumZeroFillsSkipped() == 0);
+            REQUIRE(pagedLinearAllocator.GetNumZeroFills() == 1);
+        }
+
+        /// Confirms that zeroed allocations from a Paged Block Allocator are zeroed.
+        ///
+        SECTION("PagedBlockAllocator")
+        {
+            IC::PagedBlockAllocator pagedBlockAllocator(k_blockSize, k_numBlocksPerPage);
+
+            TestZeroedAllocations(pagedBlockAllocator, k_blockSize);
+        }
+
+        /// Confirms that a Paged Block Allocator skips zeroing blocks which have never been handed out, but zeroes blocks
+        /// which are recycled after being written to. Memory is only known to be zero when it comes straight from the OS,
+        /// so each page is a whole number of OS pages.
+        ///
+        SECTION("PagedBlockAllocatorSkipsFreshBlocks")
+        {
+            IC::PagedBlockAllocator pagedBlockAllocator(k_blockSize, k_numBlocksPerOsPagedPage);
+
+            auto fresh = pagedBlockAllocator.AllocateZeroed(k_blockSize);
+
+            REQUIRE(IsZeroed(fresh, k_blockSize));
+            REQUIRE(pagedBlockAllocator.GetNumZeroFillsSkipped() == 1);
+            REQUIRE(pagedBlockAllocator.GetNumZeroFills() == 0);
+
+            std::memset(fresh, 0xFF, k_blockSize);
+            pagedBlockAllocator.Deallocate(fresh);
+
+            auto dirtied = pagedBlockAllocator.AllocateZeroed(k_blockSize);
+
+            REQUIRE(dirtied == fresh);
+            REQUIRE(IsZeroed(dirtied, k_blockSize));
+            REQUIRE(pagedBlockAllocator.GetNumZeroFillsSkipped() == 1);
+            REQUIRE(pagedBlockAllocator.GetNumZeroFills() == 1);
+
+            pagedBlockAllocator.Deallocate(dirtied);
+        }
+
+        /// Confirms that a Paged Block Allocator whose pages are smaller than an OS page, and so are not acquired directly
+        /// from the OS, always zeroes blocks.
+        ///
+        SECTION("PagedBlockAllocatorSubPage")
+        {
+            IC::PagedBlockAllocator pagedBlockAllocator(k_blockSize, k_numBlocksPerPage);
+
+            auto memory = pagedBlockAllocator.AllocateZeroed(k_blockSize);
+
+            REQUIRE(IsZeroed(memory, k_blockSize));
+            REQUIRE(pagedBlockAllocator.GetNumZeroFillsSkipped() == 0);
+            REQUIRE(pagedBlockAllocator.GetNumZeroFills() == 1);
+
+            pagedBlockAllocator.Deallocate(memory);
+        }
+
+        /// Confirms that zeroed allocations from a Buddy Allocator, which has no page tracking, are zeroed.
+        ///
+        SECTION("BuddyAllocator")
+        {
+            constexpr std::size_t k_buddyAllocatorBufferSize = 2048;
+            constexpr std::size_t k_buddyAllocatorMinBlockSize = 16;
+
+            IC::BuddyAllocator allocator(k_buddyAllocatorBufferSize, k_buddyAllocatorMinBlockSize);
+
+            TestZeroedAllocations(allocator, k_blockSize);
+        }
+
+        /// Confirms that a value initialised array is zeroed when it reuses a block which has been written to.
+        ///
+        SECTION("UniqueArrayRecycled")
+        {
+            IC::PagedBlockAllocator pagedBlockAllocator(k_blockSize, k_numBlocksPerPage);
+
+            {
+                auto dirty = IC::MakeUniqueArray<int>(pagedBlockAllocator, k_numValues);
+                for (auto i = 0; i < k_numValues; ++i)
+                {
+                    dirty[i] = -1;
+                }
+            }
+
+            auto allocated = IC::MakeUniqueArray<int>(pagedBlockAllocator, k_numValues);
+            for (auto i = 0; i < k_numValues; ++i)
+            {
+                REQUIRE(allocated[i] == 0);
+            }
+        }
+
+        /// Confirms that a value initialised array spanning freshly acquired pages is zeroed.
+        ///
+        SECTION("UniqueArrayFreshPages")
+        {
+            constexpr std::size_t k_largePageSize = 16 * 1024 * 1024;
+            constexpr std::size_t k_numLargeValues = k_largePageSize / sizeof(int) - 16;
+
+            IC::PagedLinearAllocator pagedLinearAllocator(k_largePageSize);
+
+            auto allocated = IC::MakeUniqueArray<int>(pagedLinearAllocator, k_numLargeValues);
+
+            REQUIRE(IsZeroed(allocated.get(), k_numLargeValues * sizeof(int)));
+        }
+
+        /// Confirms that a value initialised object is zeroed when it reuses a Paged Object Pool slot which has been written to.
+        ///
+        SECTION("PagedObjectPoolRecycled")
+        {
+            struct ExampleClass
+            {
+                int m_x, m_y;
+            };
+
+            IC::PagedObjectPool<ExampleClass> pagedObjectPool;
+
+            {
+                auto dirty = pagedObjectPool.Create();
+                dirty->m_x = -1;
+                dirty->m_y = -1;
+            }
+
+            auto allocated = pagedObjectPool.Create();
+
+            REQUIRE(allocated->m_x == 0);
+            REQUIRE(allocated->m_y == 0);
+        }
+    }
+}
\ No newline at end of file